@@ -0,0 +1,86 @@
+#include <benchmark/benchmark.h>
+#include <NeonFS/async/sync_wait.hpp>
+#include <NeonFS/async/thread_pool.h>
+#include <NeonFS/async/when_all.hpp>
+#include <NeonFS/async/work_stealing_executor.h>
+#include <cstdint>
+#include <memory>
+
+using namespace neonfs::async;
+
+namespace {
+    enum class Kind { SharedQueue = 0, WorkStealing = 1 };
+
+    std::unique_ptr<IExecutor> make_executor(const Kind kind, const size_t threads) {
+        if (kind == Kind::SharedQueue) return std::make_unique<ThreadPool>(threads);
+        return std::make_unique<WorkStealingExecutor>(WorkStealingConfig{.threads = threads});
+    }
+
+    // Stands in for a small piece of per-block work such as a checksum
+    uint64_t spin(uint64_t seed, const int rounds) {
+        for (int i = 0; i < rounds; ++i) seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+        return seed;
+    }
+
+    Task<uint64_t> leaf(IExecutor& executor, const uint64_t seed, const int rounds) {
+        co_await executor.schedule();
+        co_return spin(seed, rounds);
+    }
+
+    // Each branch hops onto the executor and fans out from a worker, as a read pipeline does per file
+    Task<uint64_t> branch(IExecutor& executor, const uint64_t seed, const int width, const int rounds) {
+        co_await executor.schedule();
+        std::vector<Task<uint64_t>> leaves;
+        leaves.reserve(width);
+        for (int i = 0; i < width; ++i) leaves.push_back(leaf(executor, seed + i, rounds));
+        uint64_t sum = 0;
+        for (const uint64_t value : co_await when_all(std::move(leaves))) sum += value;
+        co_return sum;
+    }
+}
+
+// Many independent tasks posted from outside the executor
+static void BM_FlatFanOut(benchmark::State& state) {
+    const auto executor = make_executor(static_cast<Kind>(state.range(0)), static_cast<size_t>(state.range(1)));
+    constexpr int tasks = 4096;
+    const int rounds = static_cast<int>(state.range(2));
+
+    for (auto _ : state) {
+        std::vector<Task<uint64_t>> work;
+        work.reserve(tasks);
+        for (int i = 0; i < tasks; ++i) work.push_back(leaf(*executor, i, rounds));
+        benchmark::DoNotOptimize(sync_wait(when_all(std::move(work))));
+    }
+    state.SetItemsProcessed(state.iterations() * tasks);
+}
+
+// Tasks spawned by tasks already on the executor: 64 branches of 64 leaves
+static void BM_NestedFanOut(benchmark::State& state) {
+    const auto executor = make_executor(static_cast<Kind>(state.range(0)), static_cast<size_t>(state.range(1)));
+    constexpr int branches = 64;
+    constexpr int width = 64;
+    const int rounds = static_cast<int>(state.range(2));
+
+    for (auto _ : state) {
+        std::vector<Task<uint64_t>> work;
+        work.reserve(branches);
+        for (int i = 0; i < branches; ++i) work.push_back(branch(*executor, static_cast<uint64_t>(i) * width, width, rounds));
+        benchmark::DoNotOptimize(sync_wait(when_all(std::move(work))));
+    }
+    state.SetItemsProcessed(state.iterations() * branches * width);
+}
+
+static void executor_args(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"executor", "threads", "rounds"});
+    for (const int kind : {0, 1}) {
+        for (const int threads : {1, 2, 4, 8}) {
+            for (const int rounds : {0, 1000}) b->Args({kind, threads, rounds});
+        }
+    }
+    b->UseRealTime();
+}
+
+BENCHMARK(BM_FlatFanOut)->Apply(executor_args);
+BENCHMARK(BM_NestedFanOut)->Apply(executor_args);
+
+BENCHMARK_MAIN();
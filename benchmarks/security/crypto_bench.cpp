@@ -0,0 +1,143 @@
+#include <benchmark/benchmark.h>
+#include <NeonFS/security/aes_encryption_provider.h>
+#include <NeonFS/security/aes_gcm_ctx_pool.h>
+#include <NeonFS/security/encryption_provider_factory.h>
+#include <NeonFS/core/secure_heap_stats.h>
+#include <openssl/rand.h>
+#include <atomic>
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <new>
+
+using namespace neonfs;
+using namespace neonfs::security;
+
+// Counts regular heap allocations per thread so each benchmark thread reports only its own.
+// secure_bytes buffers come from the secure heap and are counted by SecureHeapStats instead.
+namespace {
+    thread_local uint64_t heap_allocations = 0;
+}
+
+// The replacements stay out of line: once GCC inlines one into a caller, it pairs malloc() or free()
+// with the other operator and warns (-Wmismatched-new-delete)
+[[gnu::noinline]] void* operator new(const std::size_t size) {
+    ++heap_allocations;
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+[[gnu::noinline]] void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+[[gnu::noinline]] void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+namespace {
+    secure_bytes random_key() {
+        secure_bytes key(32);
+        if (RAND_bytes(key.data(), static_cast<int>(key.size())) != 1) std::abort();
+        return key;
+    }
+
+    // Providers are shared by all threads of a run, as they would be in a real volume
+    IEncryptionProvider& shared_provider(const CipherSuite suite, const size_t pool_size) {
+        static std::mutex mutex;
+        static std::map<std::pair<CipherSuite, size_t>, std::unique_ptr<IEncryptionProvider>> providers;
+
+        std::lock_guard<std::mutex> lock(mutex);
+        auto& provider = providers[{suite, pool_size}];
+        if (!provider) provider = EncryptionProviderFactory::create(suite, random_key(), pool_size).unwrap_move();
+        return *provider;
+    }
+
+    void report(benchmark::State& state, const size_t block_size, const uint64_t allocations, const uint64_t secure_allocations) {
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(block_size));
+        state.counters["allocs/op"] = benchmark::Counter(static_cast<double>(allocations), benchmark::Counter::kAvgIterations);
+        state.counters["secure_allocs/op"] = benchmark::Counter(static_cast<double>(secure_allocations), benchmark::Counter::kAvgIterations);
+        state.counters["secure_used"] = benchmark::Counter(static_cast<double>(SecureHeap::used()), benchmark::Counter::kAvgThreads);
+    }
+
+    // Args: block size, pool size, cipher suite
+    void BM_Encrypt(benchmark::State& state) {
+        const auto block_size = static_cast<size_t>(state.range(0));
+        auto& provider = shared_provider(static_cast<CipherSuite>(state.range(2)), static_cast<size_t>(state.range(1)));
+        const secure_bytes plain(block_size, 0x5A);
+        secure_bytes iv, tag;
+
+        const uint64_t allocations_before = heap_allocations;
+        const uint64_t secure_before = SecureHeapStats::thread_allocations();
+        for (auto _ : state) {
+            iv.clear();
+            auto cipher = provider.encrypt(plain, iv, tag);
+            if (cipher.is_err()) {
+                state.SkipWithError("encrypt failed");
+                break;
+            }
+            benchmark::DoNotOptimize(cipher);
+        }
+        report(state, block_size, heap_allocations - allocations_before, SecureHeapStats::thread_allocations() - secure_before);
+    }
+
+    // Args: block size, pool size, cipher suite
+    void BM_Decrypt(benchmark::State& state) {
+        const auto block_size = static_cast<size_t>(state.range(0));
+        auto& provider = shared_provider(static_cast<CipherSuite>(state.range(2)), static_cast<size_t>(state.range(1)));
+        const secure_bytes plain(block_size, 0x5A);
+        secure_bytes iv, tag;
+        const secure_bytes cipher = provider.encrypt(plain, iv, tag).unwrap_move();
+
+        const uint64_t allocations_before = heap_allocations;
+        const uint64_t secure_before = SecureHeapStats::thread_allocations();
+        for (auto _ : state) {
+            auto decrypted = provider.decrypt(cipher, iv, tag);
+            if (decrypted.is_err()) {
+                state.SkipWithError("decrypt failed");
+                break;
+            }
+            benchmark::DoNotOptimize(decrypted);
+        }
+        report(state, block_size, heap_allocations - allocations_before, SecureHeapStats::thread_allocations() - secure_before);
+    }
+
+    // Args: pool size. Isolates the cost of pool contention from the cipher itself.
+    void BM_CtxPoolAcquireRelease(benchmark::State& state) {
+        static std::mutex mutex;
+        static std::map<size_t, std::shared_ptr<AESGCMCtxPool>> pools;
+        std::shared_ptr<AESGCMCtxPool> pool;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto& entry = pools[static_cast<size_t>(state.range(0))];
+            if (!entry) entry = AESGCMCtxPool::create(static_cast<size_t>(state.range(0)));
+            pool = entry;
+        }
+
+        const uint64_t allocations_before = heap_allocations;
+        for (auto _ : state) {
+            auto handle = pool->acquire();
+            benchmark::DoNotOptimize(handle.operator->());
+        }
+        state.counters["allocs/op"] = benchmark::Counter(static_cast<double>(heap_allocations - allocations_before), benchmark::Counter::kAvgIterations);
+    }
+
+    const std::vector<int64_t> block_sizes = {512, 4096, 64 * 1024, 1024 * 1024};
+    const std::vector<int64_t> pool_sizes = {1, 4, 16};
+    const std::vector<int64_t> suites = {static_cast<int64_t>(CipherSuite::AES_256_GCM), static_cast<int64_t>(CipherSuite::CHACHA20_POLY1305)};
+}
+
+BENCHMARK(BM_Encrypt)->ArgNames({"block", "pool", "suite"})->ArgsProduct({block_sizes, pool_sizes, suites})->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK(BM_Decrypt)->ArgNames({"block", "pool", "suite"})->ArgsProduct({block_sizes, pool_sizes, suites})->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK(BM_CtxPoolAcquireRelease)->ArgNames({"pool"})->ArgsProduct({pool_sizes})->ThreadRange(1, 16)->UseRealTime();
+
+int main(int argc, char** argv) {
+    // 16 threads x 1 MiB blocks need roughly 16 * 3.4 MiB of secure heap (see AESEncryptionProvider.md)
+    initialize_secure_heap(256 * 1024 * 1024);
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,202 @@
+// KDF throughput and calibration tool for KeyManager.
+//
+// Measures PBKDF2 iterations per second on one thread and across thread counts, recommends an
+// iteration count for a target unlock latency, and replays an unlock storm: N volumes unlocked
+// at the same moment with the recommended count, as after a node restart.
+
+#include <NeonFS/security/key_manager.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace neonfs;
+using namespace neonfs::security;
+
+namespace {
+    struct Options {
+        std::vector<KeyDerivationAlgorithm> algorithms = {KeyDerivationAlgorithm::PBKDF2_HMAC_SHA256, KeyDerivationAlgorithm::PBKDF2_HMAC_SHA512};
+        std::chrono::milliseconds target{250};
+        std::vector<unsigned> threads;
+        unsigned storm = 0;                 // Concurrent unlocks, 0 for twice the hardware threads
+        unsigned iterations = 0;            // Iterations for the storm, 0 for the recommendation
+        double seconds = 1.0;               // Duration of each throughput measurement
+    };
+
+    const char* name_of(const KeyDerivationAlgorithm algorithm) {
+        return algorithm == KeyDerivationAlgorithm::PBKDF2_HMAC_SHA256 ? "PBKDF2-HMAC-SHA256" : "PBKDF2-HMAC-SHA512";
+    }
+
+    unsigned hardware_threads() {
+        return std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    // Aggregate iterations per second with `threads` threads deriving back to back for `seconds`
+    double measure_rate(const KeyDerivationAlgorithm algorithm, const unsigned threads, const double seconds) {
+        constexpr unsigned chunk = 10000;
+        std::atomic<bool> stop{false};
+        std::atomic<uint64_t> total{0};
+
+        std::vector<std::thread> workers;
+        workers.reserve(threads);
+        for (unsigned t = 0; t < threads; ++t) {
+            workers.emplace_back([&, t] {
+                const secure_bytes password(16, static_cast<uint8_t>(t));
+                const secure_bytes salt(16, 0x73);
+                uint64_t done = 0;
+                while (!stop.load(std::memory_order_relaxed)) {
+                    if (KeyManager::derive_key(password, salt, 32, algorithm, chunk).is_err()) break;
+                    done += chunk;
+                }
+                total.fetch_add(done, std::memory_order_relaxed);
+            });
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        std::this_thread::sleep_for(std::chrono::duration<double>(seconds));
+        stop = true;
+        for (auto& worker : workers) worker.join();
+        const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        return static_cast<double>(total.load()) / elapsed;
+    }
+
+    // Starts `count` unlocks at once and returns each one's latency in milliseconds, sorted
+    std::vector<double> run_storm(const KeyDerivationAlgorithm algorithm, const unsigned count, const unsigned iterations) {
+        std::vector<double> latencies(count);
+        std::atomic<unsigned> ready{0};
+        std::atomic<bool> go{false};
+
+        std::vector<std::thread> unlocks;
+        unlocks.reserve(count);
+        for (unsigned i = 0; i < count; ++i) {
+            unlocks.emplace_back([&, i] {
+                const secure_bytes password(16, static_cast<uint8_t>(i));
+                const secure_bytes salt(16, 0x73);
+                ready.fetch_add(1);
+                while (!go.load(std::memory_order_acquire)) std::this_thread::yield();
+
+                const auto start = std::chrono::steady_clock::now();
+                (void)KeyManager::derive_key(password, salt, 32, algorithm, iterations);
+                latencies[i] = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            });
+        }
+        while (ready.load() < count) std::this_thread::yield();
+        go.store(true, std::memory_order_release);
+        for (auto& unlock : unlocks) unlock.join();
+
+        std::sort(latencies.begin(), latencies.end());
+        return latencies;
+    }
+
+    double percentile(const std::vector<double>& sorted, const double p) {
+        if (sorted.empty()) return 0.0;
+        const auto rank = static_cast<size_t>(p / 100.0 * static_cast<double>(sorted.size() - 1) + 0.5);
+        return sorted[std::min(rank, sorted.size() - 1)];
+    }
+
+    void report(const KeyDerivationAlgorithm algorithm, const Options& options) {
+        std::cout << "== " << name_of(algorithm) << " ==\n" << std::fixed;
+
+        const auto recommended = KeyManager::calibrate_pbkdf2(options.target, algorithm);
+        if (recommended.is_err()) {
+            std::cerr << "Calibration failed: " << recommended.unwrap_err().message() << "\n";
+            return;
+        }
+
+        double single = 0.0;
+        std::cout << "threads  iter/s (total)  iter/s (per thread)  scaling\n";
+        for (const unsigned threads : options.threads) {
+            const double rate = measure_rate(algorithm, threads, options.seconds);
+            if (single == 0.0) single = rate / threads;
+            std::cout << std::setw(7) << threads << "  " << std::setw(14) << std::setprecision(0) << rate
+                      << "  " << std::setw(19) << rate / threads
+                      << "  " << std::setw(6) << std::setprecision(2) << rate / (single * threads) << "\n";
+        }
+
+        std::cout << "recommended iterations for " << options.target.count() << " ms: " << recommended.unwrap()
+                  << " (default 100000 takes " << std::setprecision(1) << 100000.0 / single * 1000.0 << " ms)\n";
+
+        const unsigned iterations = options.iterations ? options.iterations : recommended.unwrap();
+        const unsigned storm = options.storm ? options.storm : 2 * hardware_threads();
+        const auto start = std::chrono::steady_clock::now();
+        const auto latencies = run_storm(algorithm, storm, iterations);
+        const double wall = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        std::cout << "unlock storm: " << storm << " concurrent unlocks x " << iterations << " iterations\n"
+                  << "    latency (ms): p50=" << percentile(latencies, 50) << ", p99=" << percentile(latencies, 99)
+                  << ", max=" << latencies.back() << ", all unlocked after " << wall << " ms\n\n";
+    }
+
+    std::vector<unsigned> default_thread_counts() {
+        std::vector<unsigned> counts;
+        for (unsigned n = 1; n < hardware_threads(); n *= 2) counts.push_back(n);
+        counts.push_back(hardware_threads());
+        return counts;
+    }
+
+    void print_usage() {
+        std::cout <<
+            "Usage: kdf_bench [options]\n"
+            "  --algo=sha256|sha512|all  PBKDF2 variants to measure (default: all)\n"
+            "  --target-ms=N             Unlock latency to calibrate for (default: 250)\n"
+            "  --threads=N[,N...]        Thread counts to measure (default: powers of two up to the core count)\n"
+            "  --storm=N                 Concurrent unlocks in the storm (default: 2 x hardware threads)\n"
+            "  --iterations=N            Iterations per storm unlock (default: the recommendation)\n"
+            "  --seconds=S               Duration of each throughput measurement (default: 1)\n";
+    }
+
+    bool parse(const int argc, char** argv, Options& options) {
+        for (int i = 1; i < argc; ++i) {
+            const std::string arg = argv[i];
+            const auto eq = arg.find('=');
+            const std::string key = arg.substr(0, eq);
+            const std::string value = eq == std::string::npos ? "" : arg.substr(eq + 1);
+
+            if (key == "--help") { print_usage(); return false; }
+            else if (key == "--algo") {
+                if (value == "sha256") options.algorithms = {KeyDerivationAlgorithm::PBKDF2_HMAC_SHA256};
+                else if (value == "sha512") options.algorithms = {KeyDerivationAlgorithm::PBKDF2_HMAC_SHA512};
+                else if (value != "all") throw std::invalid_argument("--algo=" + value);
+            }
+            else if (key == "--target-ms") options.target = std::chrono::milliseconds(std::max(1ul, std::stoul(value)));
+            else if (key == "--threads") {
+                std::stringstream list(value);
+                for (std::string item; std::getline(list, item, ',');) {
+                    options.threads.push_back(std::max(1u, static_cast<unsigned>(std::stoul(item))));
+                }
+            }
+            else if (key == "--storm") options.storm = static_cast<unsigned>(std::stoul(value));
+            else if (key == "--iterations") options.iterations = static_cast<unsigned>(std::stoul(value));
+            else if (key == "--seconds") options.seconds = std::stod(value);
+            else {
+                std::cerr << "Unknown option: " << arg << "\n";
+                print_usage();
+                return false;
+            }
+        }
+
+        if (options.threads.empty()) options.threads = default_thread_counts();
+        return true;
+    }
+}
+
+int main(const int argc, char** argv) {
+    Options options;
+    try {
+        if (!parse(argc, argv, options)) return 1;
+    } catch (const std::exception& e) {
+        std::cerr << "Invalid option value: " << e.what() << "\n";
+        return 1;
+    }
+
+    initialize_secure_heap(16 * 1024 * 1024);
+    std::cout << "hardware threads=" << hardware_threads() << " target=" << options.target.count() << " ms\n\n";
+    for (const auto algorithm : options.algorithms) report(algorithm, options);
+    cleanup_secure_heap();
+    return 0;
+}
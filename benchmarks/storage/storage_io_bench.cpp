@@ -0,0 +1,286 @@
+// fio-like load generator for IStorageProvider implementations.
+//
+// IStorageProvider is synchronous, so a queue depth of N is emulated by N workers per job,
+// each keeping one request in flight. Total concurrency is therefore jobs x queue depth.
+
+#include <NeonFS/storage/block_storage.h>
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace neonfs;
+
+namespace {
+    struct Options {
+        std::string backend = "block";
+        std::string path;
+        size_t block_size = 4096;
+        uint64_t blocks = 25600;            // 100 MiB at 4 KiB
+        bool random = true;
+        unsigned read_percent = 70;
+        unsigned jobs = 1;
+        unsigned queue_depth = 1;
+        double seconds = 5.0;
+        double warmup_seconds = 0.5;
+        uint64_t seed = 1;
+        bool keep_file = false;
+    };
+
+    // Log-linear latency histogram: 32 sub-buckets per power of two (~3% resolution), in nanoseconds
+    class LatencyHistogram {
+        static constexpr unsigned sub_bucket_bits = 5;
+        static constexpr unsigned sub_buckets = 1u << sub_bucket_bits;
+        // Values below 2 * sub_buckets are exact; above that each power of two is split into sub_buckets
+        static constexpr unsigned bucket_count = (64 - sub_bucket_bits + 1) * sub_buckets;
+
+        std::vector<uint64_t> counts_ = std::vector<uint64_t>(bucket_count, 0);
+        uint64_t total_ = 0;
+        uint64_t max_ = 0;
+        long double sum_ = 0;
+
+        static size_t index_of(const uint64_t value) {
+            const int width = std::bit_width(value);
+            const unsigned magnitude = width > static_cast<int>(sub_bucket_bits) + 1 ? width - sub_bucket_bits - 1 : 0;
+            return static_cast<size_t>(magnitude) * sub_buckets + static_cast<size_t>(value >> magnitude);
+        }
+
+        static uint64_t upper_bound_of(const size_t index) {
+            if (index < 2 * sub_buckets) return index;
+            const size_t magnitude = index / sub_buckets - 1;
+            const uint64_t top = index - magnitude * sub_buckets;
+            return ((top + 1) << magnitude) - 1;
+        }
+
+    public:
+        void record(const uint64_t nanoseconds) {
+            ++counts_[index_of(nanoseconds)];
+            ++total_;
+            max_ = std::max(max_, nanoseconds);
+            sum_ += nanoseconds;
+        }
+
+        void merge(const LatencyHistogram& other) {
+            for (size_t i = 0; i < counts_.size(); ++i) counts_[i] += other.counts_[i];
+            total_ += other.total_;
+            max_ = std::max(max_, other.max_);
+            sum_ += other.sum_;
+        }
+
+        [[nodiscard]] uint64_t count() const { return total_; }
+        [[nodiscard]] uint64_t max() const { return max_; }
+        [[nodiscard]] double mean() const { return total_ ? static_cast<double>(sum_ / total_) : 0.0; }
+
+        [[nodiscard]] uint64_t percentile(const double p) const {
+            if (total_ == 0) return 0;
+            const auto target = static_cast<uint64_t>(std::ceil(p / 100.0 * static_cast<double>(total_)));
+            uint64_t seen = 0;
+            for (size_t i = 0; i < counts_.size(); ++i) {
+                seen += counts_[i];
+                if (seen >= target) return std::min(upper_bound_of(i), max_);
+            }
+            return max_;
+        }
+    };
+
+    struct WorkerStats {
+        LatencyHistogram reads;
+        LatencyHistogram writes;
+        uint64_t errors = 0;
+    };
+
+    struct Backend {
+        std::unique_ptr<IStorageProvider> provider;
+        std::function<void()> cleanup;
+    };
+
+    Backend open_backend(const Options& options) {
+        if (options.backend == "block") {
+            const BlockStorageConfig config{options.block_size, options.block_size * options.blocks};
+            if (auto created = storage::BlockStorage::create(options.path, config); created.is_err()) {
+                throw std::runtime_error("Failed to create container: " + std::string(created.unwrap_err().message()));
+            }
+
+            auto storage = std::make_unique<storage::BlockStorage>();
+            if (auto mounted = storage->mount(options.path, config); mounted.is_err()) {
+                throw std::runtime_error("Failed to mount container: " + std::string(mounted.unwrap_err().message()));
+            }
+
+            auto* raw = storage.get();
+            Backend backend{std::move(storage), {}};
+            backend.cleanup = [raw, path = options.path, keep = options.keep_file] {
+                raw->flush();
+                raw->unmount();
+                if (!keep) std::filesystem::remove(path);
+            };
+            return backend;
+        }
+        throw std::runtime_error("Unknown backend: " + options.backend);
+    }
+
+    void run_worker(IStorageProvider& provider, const Options& options, const unsigned worker, const unsigned workers,
+                    const std::atomic<bool>& measuring, const std::atomic<bool>& stop, WorkerStats& stats) {
+        const uint64_t block_count = provider.getBlockCount();
+        std::mt19937_64 rng(options.seed * 7919 + worker);
+        std::uniform_int_distribution<uint64_t> random_block(0, block_count - 1);
+        std::uniform_int_distribution<unsigned> percent(0, 99);
+
+        // Sequential workers start evenly spread over the device, like separate fio jobs
+        uint64_t cursor = block_count * worker / workers;
+        std::vector<uint8_t> payload(options.block_size, static_cast<uint8_t>(worker));
+
+        using clock = std::chrono::steady_clock;
+        while (!stop.load(std::memory_order_relaxed)) {
+            const uint64_t block = options.random ? random_block(rng) : cursor++ % block_count;
+            const bool is_read = percent(rng) < options.read_percent;
+
+            const auto start = clock::now();
+            bool ok;
+            if (is_read) {
+                ok = provider.readBlock(block).is_ok();
+            } else {
+                ok = provider.writeBlock(block, payload).is_ok();
+            }
+            const auto elapsed = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - start).count());
+
+            if (!measuring.load(std::memory_order_relaxed)) continue;
+            if (!ok) ++stats.errors;
+            (is_read ? stats.reads : stats.writes).record(elapsed);
+        }
+    }
+
+    void print_latency(const char* label, const LatencyHistogram& histogram, const double seconds, const size_t block_size) {
+        if (histogram.count() == 0) return;
+        const double iops = static_cast<double>(histogram.count()) / seconds;
+        const auto us = [](const double ns) { return ns / 1000.0; };
+
+        std::cout << std::fixed << std::setprecision(1)
+                  << label << ": IOPS=" << iops
+                  << ", BW=" << iops * static_cast<double>(block_size) / (1024.0 * 1024.0) << " MiB/s"
+                  << ", ops=" << histogram.count() << "\n"
+                  << "    lat (usec): mean=" << us(histogram.mean())
+                  << ", p50=" << us(static_cast<double>(histogram.percentile(50)))
+                  << ", p99=" << us(static_cast<double>(histogram.percentile(99)))
+                  << ", p99.9=" << us(static_cast<double>(histogram.percentile(99.9)))
+                  << ", max=" << us(static_cast<double>(histogram.max())) << "\n";
+    }
+
+    void print_usage() {
+        std::cout <<
+            "Usage: storage_io_bench [options]\n"
+            "  --backend=block         Storage provider to drive (default: block)\n"
+            "  --file=PATH             Container file (default: temporary file)\n"
+            "  --bs=BYTES              Block size (default: 4096)\n"
+            "  --blocks=N              Number of blocks in the container (default: 25600)\n"
+            "  --rw=rand|seq           Access pattern (default: rand)\n"
+            "  --read-pct=0..100       Percentage of reads in the mix (default: 70)\n"
+            "  --jobs=N                Independent jobs (default: 1)\n"
+            "  --iodepth=N             Requests in flight per job (default: 1)\n"
+            "  --runtime=SECONDS       Measured duration (default: 5)\n"
+            "  --warmup=SECONDS        Unmeasured warm-up (default: 0.5)\n"
+            "  --seed=N                Random seed (default: 1)\n"
+            "  --keep                  Keep the container file afterwards\n";
+    }
+
+    bool parse(const int argc, char** argv, Options& options) {
+        for (int i = 1; i < argc; ++i) {
+            const std::string arg = argv[i];
+            const auto eq = arg.find('=');
+            const std::string key = arg.substr(0, eq);
+            const std::string value = eq == std::string::npos ? "" : arg.substr(eq + 1);
+
+            if (key == "--help") { print_usage(); return false; }
+            else if (key == "--backend") options.backend = value;
+            else if (key == "--file") options.path = value;
+            else if (key == "--bs") options.block_size = std::stoul(value);
+            else if (key == "--blocks") options.blocks = std::stoull(value);
+            else if (key == "--rw") options.random = value != "seq";
+            else if (key == "--read-pct") options.read_percent = std::min(100u, static_cast<unsigned>(std::stoul(value)));
+            else if (key == "--jobs") options.jobs = std::max(1u, static_cast<unsigned>(std::stoul(value)));
+            else if (key == "--iodepth") options.queue_depth = std::max(1u, static_cast<unsigned>(std::stoul(value)));
+            else if (key == "--runtime") options.seconds = std::stod(value);
+            else if (key == "--warmup") options.warmup_seconds = std::stod(value);
+            else if (key == "--seed") options.seed = std::stoull(value);
+            else if (key == "--keep") options.keep_file = true;
+            else {
+                std::cerr << "Unknown option: " << arg << "\n";
+                print_usage();
+                return false;
+            }
+        }
+
+        if (options.path.empty()) {
+            options.path = (std::filesystem::temp_directory_path() / "neonfs_storage_io_bench.bin").string();
+        }
+        return true;
+    }
+}
+
+int main(const int argc, char** argv) {
+    Options options;
+    try {
+        if (!parse(argc, argv, options)) return 1;
+    } catch (const std::exception& e) {
+        std::cerr << "Invalid option value: " << e.what() << "\n";
+        return 1;
+    }
+
+    Backend backend;
+    try {
+        backend = open_backend(options);
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << "\n";
+        return 1;
+    }
+
+    const unsigned workers = options.jobs * options.queue_depth;
+    std::cout << "backend=" << options.backend << " bs=" << options.block_size << " blocks=" << options.blocks
+              << " rw=" << (options.random ? "rand" : "seq") << " read-pct=" << options.read_percent
+              << " jobs=" << options.jobs << " iodepth=" << options.queue_depth << " (" << workers << " workers)\n";
+
+    std::atomic<bool> measuring{false};
+    std::atomic<bool> stop{false};
+    std::vector<WorkerStats> stats(workers);
+    std::vector<std::thread> threads;
+    threads.reserve(workers);
+    for (unsigned w = 0; w < workers; ++w) {
+        threads.emplace_back(run_worker, std::ref(*backend.provider), std::cref(options), w, workers,
+                             std::cref(measuring), std::cref(stop), std::ref(stats[w]));
+    }
+
+    std::this_thread::sleep_for(std::chrono::duration<double>(options.warmup_seconds));
+    const auto start = std::chrono::steady_clock::now();
+    measuring = true;
+    std::this_thread::sleep_for(std::chrono::duration<double>(options.seconds));
+    measuring = false;
+    const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    stop = true;
+    for (auto& thread : threads) thread.join();
+
+    WorkerStats total;
+    for (const auto& s : stats) {
+        total.reads.merge(s.reads);
+        total.writes.merge(s.writes);
+        total.errors += s.errors;
+    }
+
+    print_latency("read ", total.reads, elapsed, options.block_size);
+    print_latency("write", total.writes, elapsed, options.block_size);
+    LatencyHistogram all = total.reads;
+    all.merge(total.writes);
+    print_latency("total", all, elapsed, options.block_size);
+    if (total.errors) std::cout << "errors=" << total.errors << "\n";
+
+    if (backend.cleanup) backend.cleanup();
+    return total.errors ? 2 : 0;
+}
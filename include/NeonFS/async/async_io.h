@@ -0,0 +1,40 @@
+#pragma once
+#include <NeonFS/async/executor.h>
+#include <NeonFS/async/task.hpp>
+#include <NeonFS/core/interfaces.h>
+
+namespace neonfs::async {
+    /*
+     * Awaitable wrappers over the blocking storage and crypto interfaces. Each hops onto `executor`,
+     * makes the blocking call there and completes on that thread, so the awaiting coroutine also
+     * continues there. Buffers are taken by value and live in the coroutine frame; move them in.
+     * The providers must outlive the task. The overloads without an executor schedule onto
+     * `WorkStealingExecutor::shared()`.
+     */
+
+    Task<Result<std::vector<uint8_t>>> read_block(IExecutor& executor, IStorageProvider& storage, uint64_t blockId);
+
+    Task<Result<void>> write_block(IExecutor& executor, IStorageProvider& storage, uint64_t blockId, std::vector<uint8_t> data);
+
+    // `outIV` and `outTag` are written when the task completes; keep them alive until then
+    Task<Result<secure_bytes>> encrypt(IExecutor& executor, IEncryptionProvider& provider, secure_bytes plain, secure_bytes& outIV, secure_bytes& outTag);
+
+    Task<Result<secure_bytes>> decrypt(IExecutor& executor, IEncryptionProvider& provider, secure_bytes cipher, secure_bytes iv, secure_bytes tag);
+
+    // A file the provider does not know completes with ErrorKind::NotFound
+    Task<Result<Metadata>> get_metadata(IExecutor& executor, IMetadataProvider& metadata, uint64_t fileId);
+
+    Task<Result<void>> upsert_metadata(IExecutor& executor, IMetadataProvider& metadata, Metadata meta);
+
+    Task<Result<std::vector<uint8_t>>> read_block(IStorageProvider& storage, uint64_t blockId);
+
+    Task<Result<void>> write_block(IStorageProvider& storage, uint64_t blockId, std::vector<uint8_t> data);
+
+    Task<Result<secure_bytes>> encrypt(IEncryptionProvider& provider, secure_bytes plain, secure_bytes& outIV, secure_bytes& outTag);
+
+    Task<Result<secure_bytes>> decrypt(IEncryptionProvider& provider, secure_bytes cipher, secure_bytes iv, secure_bytes tag);
+
+    Task<Result<Metadata>> get_metadata(IMetadataProvider& metadata, uint64_t fileId);
+
+    Task<Result<void>> upsert_metadata(IMetadataProvider& metadata, Metadata meta);
+} // namespace neonfs::async
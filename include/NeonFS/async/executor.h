@@ -0,0 +1,26 @@
+#pragma once
+#include <coroutine>
+
+namespace neonfs::async {
+    /**
+     * @brief Somewhere to resume coroutines: a thread pool, an I/O loop, or the calling thread in tests.
+     */
+    class IExecutor {
+    public:
+        virtual ~IExecutor() = default;
+
+        // Queues `handle` to be resumed on one of the executor's threads. Must not resume it inline.
+        virtual void post(std::coroutine_handle<> handle) = 0;
+
+        struct ScheduleAwaiter {
+            IExecutor& executor;
+
+            bool await_ready() const noexcept { return false; }
+            void await_suspend(const std::coroutine_handle<> handle) const { executor.post(handle); }
+            void await_resume() const noexcept {}
+        };
+
+        // `co_await executor.schedule()` continues the awaiting coroutine on this executor
+        [[nodiscard]] ScheduleAwaiter schedule() noexcept { return ScheduleAwaiter{*this}; }
+    };
+} // namespace neonfs::async
@@ -0,0 +1,79 @@
+#pragma once
+#include <NeonFS/async/task.hpp>
+#include <semaphore>
+
+namespace neonfs::async {
+    namespace detail {
+        // Coroutine that awaits one task and signals a semaphore when it is done
+        class SyncWaiter {
+        public:
+            struct promise_type {
+                std::binary_semaphore* done = nullptr;
+                std::exception_ptr exception;
+
+                SyncWaiter get_return_object() noexcept {
+                    return SyncWaiter(std::coroutine_handle<promise_type>::from_promise(*this));
+                }
+
+                std::suspend_always initial_suspend() noexcept { return {}; }
+
+                auto final_suspend() noexcept {
+                    struct Signal {
+                        bool await_ready() noexcept { return false; }
+                        // Releasing is the last access to the frame; the waiting thread destroys it
+                        void await_suspend(const std::coroutine_handle<promise_type> handle) noexcept { handle.promise().done->release(); }
+                        void await_resume() noexcept {}
+                    };
+                    return Signal{};
+                }
+
+                void return_void() noexcept {}
+                void unhandled_exception() noexcept { exception = std::current_exception(); }
+            };
+
+            SyncWaiter(SyncWaiter&& other) noexcept : handle(std::exchange(other.handle, {})) {}
+            ~SyncWaiter() {
+                if (handle) handle.destroy();
+            }
+
+            void run() {
+                std::binary_semaphore done{0};
+                handle.promise().done = &done;
+                resume(handle);
+                done.acquire();
+                if (handle.promise().exception) std::rethrow_exception(handle.promise().exception);
+            }
+
+        private:
+            explicit SyncWaiter(const std::coroutine_handle<promise_type> handle) noexcept : handle(handle) {}
+
+            std::coroutine_handle<promise_type> handle;
+        };
+
+        template<typename T>
+        SyncWaiter await_into(Task<T>& task, std::optional<T>& out) {
+            out.emplace(co_await task);
+        }
+
+        inline SyncWaiter await_into(Task<void>& task) {
+            co_await task;
+        }
+    } // namespace detail
+
+    /**
+     * @brief Runs `task` to completion, blocking the calling thread, and returns its value.
+     *
+     * The task may hop to other threads, e.g. through `IExecutor::schedule`; this thread only waits.
+     * Never call it from an executor thread that the task needs, or the task can deadlock.
+     */
+    template<typename T>
+    T sync_wait(Task<T> task) {
+        if constexpr (std::is_void_v<T>) {
+            detail::await_into(task).run();
+        } else {
+            std::optional<T> result;
+            detail::await_into(task, result).run();
+            return std::move(*result);
+        }
+    }
+} // namespace neonfs::async
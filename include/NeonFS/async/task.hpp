@@ -0,0 +1,290 @@
+#pragma once
+#include <NeonFS/core/result.hpp>
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace neonfs::async {
+    template<typename T>
+    class Task;
+
+    template<typename T>
+    struct is_result : std::false_type {};
+    template<typename T>
+    struct is_result<Result<T>> : std::true_type {};
+    template<typename T>
+    inline constexpr bool is_result_v = is_result<T>::value;
+
+    template<typename T>
+    struct Propagate;
+
+    namespace detail {
+        // Coroutines handed to this thread's trampoline, and whether a `transfer` on this thread is draining them
+        struct Trampoline {
+            bool running = false;
+            std::vector<std::coroutine_handle<>> pending;
+        };
+
+        inline thread_local Trampoline trampoline;
+
+        /**
+         * @brief Hands control to `next` from an `await_suspend`, without growing the stack.
+         *
+         * Returning the next handle from `await_suspend` only keeps the stack flat when the compiler emits
+         * the resume as a tail call, which unoptimised builds do not. Instead the outermost transfer on a
+         * thread resumes `next` and then every coroutine queued by nested transfers in a loop, and nested
+         * transfers only queue theirs, so await chains of any depth run in bounded stack.
+         */
+        inline std::coroutine_handle<> transfer(const std::coroutine_handle<> next) noexcept {
+            if (next == std::noop_coroutine()) return next;
+            if (trampoline.running) {
+                trampoline.pending.push_back(next);
+                return std::noop_coroutine();
+            }
+            // Entries below `base` belong to an enclosing `resume`, which drains them itself
+            const size_t base = trampoline.pending.size();
+            trampoline.running = true;
+            next.resume();
+            while (trampoline.pending.size() > base) {
+                const std::coroutine_handle<> queued = trampoline.pending.back();
+                trampoline.pending.pop_back();
+                queued.resume();
+            }
+            trampoline.running = false;
+            return std::noop_coroutine();
+        }
+
+        // Resumes `handle` from ordinary code and runs it until it suspends, even inside another coroutine's trampoline
+        inline void resume(const std::coroutine_handle<> handle) noexcept {
+            const bool running = std::exchange(trampoline.running, false);
+            transfer(handle);
+            trampoline.running = running;
+        }
+
+        template<typename T>
+        struct is_propagate : std::false_type {};
+        template<typename T>
+        struct is_propagate<Propagate<T>> : std::true_type {};
+
+        /**
+         * @brief State shared by all task promises: who to resume on completion, and where errors propagate.
+         *
+         * `sink` is the promise of a coroutine that awaited this one through `propagate`. If this task
+         * completes with an error `Result`, the error is stored in the sink and the sink's own awaiter is
+         * resumed instead, so the sink never continues past the failed `co_await`.
+         */
+        struct PromiseBase {
+            std::coroutine_handle<> continuation;
+            PromiseBase* sink = nullptr;
+            std::exception_ptr exception;
+
+            virtual ~PromiseBase() = default;
+
+            // The error of a task that completed with an error Result, else nullptr
+            [[nodiscard]] virtual const Error* error() const noexcept = 0;
+
+            // Completes a Result-valued task with `error`; only called on such tasks
+            virtual void set_error(const Error& error) noexcept = 0;
+
+            // The coroutine to transfer to once this task has completed
+            [[nodiscard]] std::coroutine_handle<> next() noexcept {
+                if (sink) {
+                    if (const Error* failed = error()) {
+                        sink->set_error(*failed);
+                        return sink->next();
+                    }
+                }
+                return continuation ? continuation : std::noop_coroutine();
+            }
+
+            void unhandled_exception() noexcept { exception = std::current_exception(); }
+
+            struct FinalAwaiter {
+                bool await_ready() noexcept { return false; }
+                template<typename Promise>
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept {
+                    return transfer(handle.promise().next());
+                }
+                void await_resume() noexcept {}
+            };
+
+            std::suspend_always initial_suspend() noexcept { return {}; }
+            FinalAwaiter final_suspend() noexcept { return {}; }
+        };
+
+        // Awaiting a Result inside a Result-valued task yields its value, or ends the task with its error
+        template<typename U>
+        struct ResultAwaiter {
+            Result<U> result;
+
+            bool await_ready() const noexcept { return result.is_ok(); }
+
+            template<typename Promise>
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept {
+                handle.promise().set_error(result.unwrap_err());
+                return transfer(handle.promise().next());
+            }
+
+            U await_resume() {
+                if constexpr (!std::is_void_v<U>) return result.unwrap_move();
+            }
+        };
+
+        template<typename T>
+        struct PromiseStorage : PromiseBase {
+            std::optional<T> value;
+
+            template<typename V> requires std::convertible_to<V&&, T>
+            void return_value(V&& v) noexcept(std::is_nothrow_constructible_v<T, V&&>) {
+                value.emplace(std::forward<V>(v));
+            }
+
+            [[nodiscard]] const Error* error() const noexcept override {
+                if constexpr (is_result_v<T>) {
+                    if (value && value->is_err()) return &value->unwrap_err();
+                }
+                return nullptr;
+            }
+
+            void set_error(const Error& error) noexcept override {
+                if constexpr (is_result_v<T>) value.emplace(T::err(error));
+            }
+
+            T take() {
+                if (exception) std::rethrow_exception(exception);
+                return std::move(*value);
+            }
+        };
+
+        template<>
+        struct PromiseStorage<void> : PromiseBase {
+            void return_void() noexcept {}
+            [[nodiscard]] const Error* error() const noexcept override { return nullptr; }
+            void set_error(const Error&) noexcept override {}
+
+            void take() {
+                if (exception) std::rethrow_exception(exception);
+            }
+        };
+    } // namespace detail
+
+    /**
+     * @brief Lazily started coroutine producing a `T`, usually a `Result`.
+     *
+     * A task starts when it is first awaited and resumes its awaiter when it completes, through the
+     * thread's trampoline, so long await chains do not grow the stack even in unoptimised builds. Exceptions escaping the body are rethrown
+     * to the awaiter. Use `sync_wait` to run a task from ordinary code.
+     *
+     * Inside a task returning `Result<T>`, `co_await` on a `Result<U>` yields the `U`, or ends the task
+     * with the error; `co_await propagate(task)` does the same for a nested `Task<Result<U>>`.
+     */
+    template<typename T>
+    class [[nodiscard]] Task {
+    public:
+        struct promise_type : detail::PromiseStorage<T> {
+            Task get_return_object() noexcept {
+                return Task(std::coroutine_handle<promise_type>::from_promise(*this));
+            }
+
+            template<typename A> requires (!is_result_v<std::remove_cvref_t<A>> && !detail::is_propagate<std::remove_cvref_t<A>>::value)
+            A&& await_transform(A&& awaitable) noexcept {
+                return std::forward<A>(awaitable);
+            }
+
+            template<typename U> requires is_result_v<T>
+            detail::ResultAwaiter<U> await_transform(Result<U> result) {
+                return {std::move(result)};
+            }
+
+            template<typename U> requires is_result_v<T>
+            auto await_transform(Propagate<U>&& propagate) noexcept;
+        };
+
+        Task() noexcept = default;
+        Task(Task&& other) noexcept : handle_(std::exchange(other.handle_, {})) {}
+
+        Task& operator=(Task&& other) noexcept {
+            if (this != &other) {
+                if (handle_) handle_.destroy();
+                handle_ = std::exchange(other.handle_, {});
+            }
+            return *this;
+        }
+
+        ~Task() {
+            if (handle_) handle_.destroy();
+        }
+
+        Task(const Task&) = delete;
+        Task& operator=(const Task&) = delete;
+
+        [[nodiscard]] bool done() const noexcept { return !handle_ || handle_.done(); }
+
+        auto operator co_await() & noexcept { return Awaiter{handle_}; }
+        auto operator co_await() && noexcept { return Awaiter{handle_}; }
+
+    private:
+        template<typename U>
+        friend struct Propagate;
+
+        explicit Task(const std::coroutine_handle<promise_type> handle) noexcept : handle_(handle) {}
+
+        struct Awaiter {
+            std::coroutine_handle<promise_type> handle;
+
+            bool await_ready() const noexcept { return !handle || handle.done(); }
+
+            std::coroutine_handle<> await_suspend(const std::coroutine_handle<> awaiting) noexcept {
+                handle.promise().continuation = awaiting;
+                return detail::transfer(handle);
+            }
+
+            T await_resume() { return handle.promise().take(); }
+        };
+
+        std::coroutine_handle<promise_type> handle_;
+    };
+
+    /**
+     * @brief Awaits a `Task<Result<U>>` inside a Result-valued task, yielding the `U` or propagating the error.
+     */
+    template<typename U>
+    struct Propagate {
+        Task<Result<U>> task;
+
+        struct Awaiter {
+            std::coroutine_handle<typename Task<Result<U>>::promise_type> handle;
+
+            bool await_ready() const noexcept { return false; }
+
+            template<typename Promise>
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> awaiting) noexcept {
+                handle.promise().continuation = awaiting;
+                handle.promise().sink = &awaiting.promise();
+                return detail::transfer(handle);
+            }
+
+            // Only reached on success; a failed task resumes the awaiter's awaiter instead
+            U await_resume() {
+                Result<U> result = handle.promise().take();
+                if constexpr (!std::is_void_v<U>) return result.unwrap_move();
+            }
+        };
+
+        Awaiter awaiter() noexcept { return Awaiter{task.handle_}; }
+    };
+
+    template<typename U>
+    [[nodiscard]] Propagate<U> propagate(Task<Result<U>>&& task) noexcept {
+        return Propagate<U>{std::move(task)};
+    }
+
+    template<typename T>
+    template<typename U> requires is_result_v<T>
+    auto Task<T>::promise_type::await_transform(Propagate<U>&& propagate) noexcept {
+        return propagate.awaiter();
+    }
+} // namespace neonfs::async
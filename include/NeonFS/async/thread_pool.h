@@ -0,0 +1,39 @@
+#pragma once
+#include <NeonFS/async/executor.h>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace neonfs::async {
+    /**
+     * @brief Fixed set of worker threads resuming coroutines from a shared FIFO queue.
+     *
+     * Blocking storage and crypto calls run on these threads, so a few threads keep many operations in
+     * flight: each coroutine occupies a thread only while it computes or blocks in a call. The
+     * destructor finishes everything already queued, then joins the workers.
+     */
+    class ThreadPool final : public IExecutor {
+    public:
+        // 0 threads means one per hardware thread
+        explicit ThreadPool(size_t threads = 0);
+        ~ThreadPool() override;
+
+        void post(std::coroutine_handle<> handle) override;
+
+        [[nodiscard]] size_t thread_count() const noexcept;
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+    private:
+        void work();
+
+        std::mutex mutex;
+        std::condition_variable available;
+        std::deque<std::coroutine_handle<>> queue;
+        bool stopping = false;
+        std::vector<std::thread> workers;
+    };
+} // namespace neonfs::async
@@ -0,0 +1,137 @@
+#pragma once
+#include <NeonFS/async/task.hpp>
+#include <atomic>
+#include <vector>
+
+namespace neonfs::async {
+    namespace detail {
+        struct WhenAllState {
+            std::atomic<size_t> remaining;
+            std::coroutine_handle<> parent;
+        };
+
+        // Awaits one task of a `when_all`; the last one to finish resumes the parent
+        class WhenAllChild {
+        public:
+            struct promise_type {
+                WhenAllState* state = nullptr;
+
+                WhenAllChild get_return_object() noexcept {
+                    return WhenAllChild(std::coroutine_handle<promise_type>::from_promise(*this));
+                }
+
+                std::suspend_always initial_suspend() noexcept { return {}; }
+
+                auto final_suspend() noexcept {
+                    struct Arrive {
+                        bool await_ready() noexcept { return false; }
+                        std::coroutine_handle<> await_suspend(const std::coroutine_handle<promise_type> handle) noexcept {
+                            WhenAllState& state = *handle.promise().state;
+                            if (state.remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) return transfer(state.parent);
+                            return std::noop_coroutine();
+                        }
+                        void await_resume() noexcept {}
+                    };
+                    return Arrive{};
+                }
+
+                void return_void() noexcept {}
+                void unhandled_exception() noexcept { std::terminate(); }  // Task rethrows into the child, which catches
+            };
+
+            WhenAllChild(WhenAllChild&& other) noexcept : handle(std::exchange(other.handle, {})) {}
+            ~WhenAllChild() {
+                if (handle) handle.destroy();
+            }
+
+            void start(WhenAllState& state) {
+                handle.promise().state = &state;
+                resume(handle);
+            }
+
+        private:
+            explicit WhenAllChild(const std::coroutine_handle<promise_type> handle) noexcept : handle(handle) {}
+
+            std::coroutine_handle<promise_type> handle;
+        };
+
+        template<typename T>
+        WhenAllChild await_slot(Task<T>& task, std::optional<T>& slot, std::exception_ptr& failure) {
+            try {
+                slot.emplace(co_await task);
+            } catch (...) {
+                failure = std::current_exception();
+            }
+        }
+
+        inline WhenAllChild await_slot(Task<void>& task, std::exception_ptr& failure) {
+            try {
+                co_await task;
+            } catch (...) {
+                failure = std::current_exception();
+            }
+        }
+
+        struct WhenAllAwaiter {
+            std::vector<WhenAllChild>& children;
+            WhenAllState& state;
+
+            bool await_ready() const noexcept { return children.empty(); }
+
+            bool await_suspend(const std::coroutine_handle<> parent) {
+                state.parent = parent;
+                for (auto& child : children) child.start(state);
+                // The extra count held while starting: if every child already finished, do not suspend
+                return state.remaining.fetch_sub(1, std::memory_order_acq_rel) != 1;
+            }
+
+            void await_resume() const noexcept {}
+        };
+    } // namespace detail
+
+    /**
+     * @brief Runs `tasks` concurrently and returns their values in order once all have completed.
+     *
+     * Each task runs inline until it first suspends, e.g. on `IExecutor::schedule`, so tasks that hop
+     * to an executor proceed in parallel. The first exception thrown by a task is rethrown once all
+     * are done; errors returned as `Result` are just values here.
+     */
+    template<typename T>
+    Task<std::vector<T>> when_all(std::vector<Task<T>> tasks) {
+        std::vector<std::optional<T>> slots(tasks.size());
+        std::vector<std::exception_ptr> failures(tasks.size());
+        detail::WhenAllState state{tasks.size() + 1, {}};
+
+        std::vector<detail::WhenAllChild> children;
+        children.reserve(tasks.size());
+        for (size_t i = 0; i < tasks.size(); ++i) children.push_back(detail::await_slot(tasks[i], slots[i], failures[i]));
+
+        co_await detail::WhenAllAwaiter{children, state};
+
+        for (const auto& failure : failures) {
+            if (failure) std::rethrow_exception(failure);
+        }
+        std::vector<T> results;
+        results.reserve(slots.size());
+        for (auto& slot : slots) results.push_back(std::move(*slot));
+        co_return results;
+    }
+
+    /**
+     * @brief Runs `tasks` concurrently and completes once all have, rethrowing the first exception.
+     */
+    inline Task<void> when_all(std::vector<Task<void>> tasks) {
+        std::vector<std::exception_ptr> failures(tasks.size());
+        detail::WhenAllState state{tasks.size() + 1, {}};
+
+        std::vector<detail::WhenAllChild> children;
+        children.reserve(tasks.size());
+        for (size_t i = 0; i < tasks.size(); ++i) children.push_back(detail::await_slot(tasks[i], failures[i]));
+
+        co_await detail::WhenAllAwaiter{children, state};
+
+        for (const auto& failure : failures) {
+            if (failure) std::rethrow_exception(failure);
+        }
+    }
+} // namespace neonfs::async
@@ -0,0 +1,82 @@
+#pragma once
+#include <NeonFS/async/executor.h>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace neonfs::async {
+    struct WorkStealingConfig {
+        size_t threads = 0;         // 0 for one per CPU the process may run on
+        bool numaAware = true;      // Spread workers over NUMA nodes, keep each on its node, and steal from the same node first
+        bool pinThreads = false;    // Pin each worker to a single CPU
+    };
+
+    /**
+     * @brief Thread pool with one deque per worker, shared by storage, crypto and metadata work.
+     *
+     * Coroutines posted from a worker go to the back of that worker's deque, so a pipeline stays on the
+     * core whose caches hold its frame. Coroutines posted from other threads are spread round-robin.
+     * A worker runs its own deque oldest first; once it is empty, the worker steals the newer half of
+     * another worker's deque, trying workers on its own NUMA node before remote ones.
+     *
+     * NUMA nodes are read from sysfs on Linux; elsewhere all CPUs are one node. `shared()` is the
+     * process-wide instance; the async storage, crypto and metadata helpers that take no executor
+     * schedule onto it, so they do not each start threads and oversubscribe the cores.
+     */
+    class WorkStealingExecutor final : public IExecutor {
+    public:
+        explicit WorkStealingExecutor(WorkStealingConfig config = {});
+        ~WorkStealingExecutor() override;
+
+        void post(std::coroutine_handle<> handle) override;
+
+        [[nodiscard]] size_t thread_count() const noexcept;
+
+        // The calling thread's worker index, or nullopt if it is not one of this executor's workers
+        [[nodiscard]] std::optional<size_t> current_worker() const noexcept;
+
+        // The NUMA node worker `index` was placed on
+        [[nodiscard]] int node_of(size_t index) const;
+
+        // The CPU worker `index` is pinned to, or -1 if it is not pinned
+        [[nodiscard]] int cpu_of(size_t index) const;
+
+        // Coroutines taken from another worker's deque since construction
+        [[nodiscard]] uint64_t steals() const noexcept;
+
+        // Process-wide executor with the default configuration, started on first use
+        static WorkStealingExecutor& shared();
+
+        WorkStealingExecutor(const WorkStealingExecutor&) = delete;
+        WorkStealingExecutor& operator=(const WorkStealingExecutor&) = delete;
+
+    private:
+        struct Worker {
+            std::mutex mutex;
+            std::deque<std::coroutine_handle<>> deque;
+            std::vector<size_t> victims;    // Same node first, then the rest
+            int node = 0;
+            int cpu = -1;
+            std::thread thread;
+        };
+
+        void work(size_t index);
+        std::coroutine_handle<> take(size_t index);
+        std::coroutine_handle<> steal(size_t index);
+        void wake();
+
+        std::vector<std::unique_ptr<Worker>> workers;
+        std::atomic<size_t> pending{0};     // Queued in any deque and not yet taken
+        std::atomic<size_t> sleeping{0};
+        std::atomic<size_t> nextExternal{0};
+        std::atomic<uint64_t> stolen{0};
+        std::atomic<bool> stopping{false};
+        std::mutex sleepMutex;
+        std::condition_variable available;
+    };
+} // namespace neonfs::async
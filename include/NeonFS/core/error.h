@@ -0,0 +1,114 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace neonfs {
+    /**
+     * @brief Category of an `Error`, for callers that branch on the kind of failure rather than its text.
+     */
+    enum class ErrorKind : uint8_t {
+        Unknown = 0,
+        InvalidArgument,        // A parameter is out of range or malformed
+        NotFound,
+        OutOfRange,             // e.g. a block ID beyond the end of the store
+        NotMounted,
+        Io,                     // The operating system failed a read, write or seek
+        Authentication,         // A tag or key check failed: wrong key, or tampered or corrupted data
+        Crypto,                 // The cryptographic library failed for another reason
+        ResourceExhausted,      // Out of memory, IV space or similar
+        Unsupported,
+    };
+
+    [[nodiscard]] constexpr std::string_view to_string(const ErrorKind kind) noexcept {
+        switch (kind) {
+            case ErrorKind::InvalidArgument: return "invalid argument";
+            case ErrorKind::NotFound: return "not found";
+            case ErrorKind::OutOfRange: return "out of range";
+            case ErrorKind::NotMounted: return "not mounted";
+            case ErrorKind::Io: return "I/O error";
+            case ErrorKind::Authentication: return "authentication failed";
+            case ErrorKind::Crypto: return "cryptographic failure";
+            case ErrorKind::ResourceExhausted: return "resource exhausted";
+            case ErrorKind::Unsupported: return "unsupported";
+            case ErrorKind::Unknown: break;
+        }
+        return "error";
+    }
+
+    /**
+     * @brief Text with static storage duration, such as a string literal, that an `Error` may keep by pointer.
+     *
+     * The constructor is `consteval`, so it only accepts arrays whose address is a constant: string
+     * literals and static arrays. A stack buffer, e.g. one filled by `snprintf`, does not compile here;
+     * pass it as a `std::string`, or as a non-const array, which `Error` and `Result::err` copy.
+     */
+    class StaticText {
+    public:
+        constexpr StaticText() noexcept = default;
+
+        template<size_t N>
+        consteval StaticText(const char (&literal)[N]) noexcept : text_(literal) {}
+
+        [[nodiscard]] constexpr const char* c_str() const noexcept { return text_; }
+
+    private:
+        const char* text_ = nullptr;
+    };
+
+    /**
+     * @brief Failure carried by `Result`: a kind, an optional context message and a numeric code.
+     *
+     * Errors built from a kind or a `StaticText` only store a pointer to static text, so creating,
+     * copying and returning them never allocates. Only errors built from a `std::string` own their
+     * message, shared between copies. `message()` picks the text lazily: the owned message, else the
+     * static context, else the name of the kind.
+     */
+    class Error {
+    public:
+        Error() noexcept = default;
+
+        constexpr Error(const ErrorKind kind, const StaticText context = {}, const int code = 0) noexcept
+            : context_(context.c_str()), code_(code), kind_(kind) {}
+
+        // A string literal is stored by pointer
+        constexpr Error(const StaticText literal, const int code = 0) noexcept
+            : context_(literal.c_str()), code_(code) {}
+
+        // Formatted messages are owned and allocate once; keep them off hot failure paths. A template
+        // only so that a literal, which converts to both, prefers the non-template `StaticText` overload.
+        template<typename = void>
+        Error(std::string message, const int code = 0, const ErrorKind kind = ErrorKind::Unknown)
+            : owned_(std::make_shared<const std::string>(std::move(message))), code_(code), kind_(kind) {}
+
+        // A writable buffer may change or go out of scope, so its text is copied
+        template<size_t N>
+        Error(char (&buffer)[N], const int code = 0, const ErrorKind kind = ErrorKind::Unknown)
+            : Error(std::string(buffer), code, kind) {}
+
+        [[nodiscard]] ErrorKind kind() const noexcept { return kind_; }
+        [[nodiscard]] int code() const noexcept { return code_; }
+
+        [[nodiscard]] std::string_view message() const noexcept {
+            if (owned_) return *owned_;
+            if (context_) return context_;
+            return to_string(kind_);
+        }
+
+        // Kind, message and code in one line, for logs. Allocates; call it only when reporting.
+        [[nodiscard]] std::string describe() const {
+            std::string text(to_string(kind_));
+            if (owned_ || context_) text.append(": ").append(message());
+            if (code_ != 0) text.append(" (code ").append(std::to_string(code_)).append(")");
+            return text;
+        }
+
+    private:
+        std::shared_ptr<const std::string> owned_;
+        const char* context_ = nullptr;
+        int code_ = 0;
+        ErrorKind kind_ = ErrorKind::Unknown;
+    };
+} // namespace neonfs
@@ -0,0 +1,36 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+
+namespace neonfs {
+    /**
+     * @brief Striped reader-writer locks by file ID, shared by foreground I/O and background jobs.
+     *
+     * A reader holds the shared lock of a file from reading its metadata until it has decrypted
+     * the blocks, so a background job cannot swap a block and its IV and tag in between. Anything
+     * that rewrites a block together with its metadata takes the exclusive lock.
+     *
+     * Files hash onto a fixed number of stripes, so unrelated files occasionally share a lock.
+     *
+     * Block locks serialise writes to a storage block shared by several files, such as a pack block of
+     * tails, whose range writes may read, patch and write back the whole block. They hash onto their own
+     * stripes and are taken after the file lock, around the write only.
+     */
+    class FileLockTable {
+    public:
+        static constexpr size_t stripe_count = 64;
+
+        [[nodiscard]] std::shared_lock<std::shared_mutex> lock_shared(uint64_t fileId);
+        [[nodiscard]] std::unique_lock<std::shared_mutex> lock_exclusive(uint64_t fileId);
+        [[nodiscard]] std::unique_lock<std::mutex> lock_block(uint64_t blockId);
+
+    private:
+        static size_t stripe_index(uint64_t id);
+        std::shared_mutex& stripe(uint64_t fileId);
+
+        std::array<std::shared_mutex, stripe_count> stripes;
+        std::array<std::mutex, stripe_count> blockStripes;
+    };
+} // namespace neonfs
@@ -1,6 +1,8 @@
 #pragma once
 #include "result.hpp"
 #include "types.h"
+#include <algorithm>
+#include <span>
 #include <vector>
 
 namespace neonfs {
@@ -27,7 +29,57 @@ namespace neonfs {
         virtual ~IStorageProvider() = default;
 
         virtual Result<std::vector<uint8_t>> readBlock(uint64_t blockID) = 0;
+
+        /**
+         * @brief Reads a block into a caller-owned buffer of at least the block size, e.g. a reused or pooled one.
+         * @return The filled prefix of `buffer`, borrowed from the caller.
+         *
+         * The default goes through `readBlock`; providers override it to skip the intermediate vector.
+         */
+        virtual Result<std::span<uint8_t>> readBlockInto(const uint64_t blockID, const std::span<uint8_t> buffer) {
+            if (buffer.size() < getBlockSize()) {
+                return Result<std::span<uint8_t>>::err(ErrorKind::InvalidArgument, "Buffer is smaller than a block");
+            }
+            auto block = readBlock(blockID);
+            if (block.is_err()) return Result<std::span<uint8_t>>::err(block.unwrap_err());
+            std::copy(block.unwrap().begin(), block.unwrap().end(), buffer.begin());
+            return Result<std::span<uint8_t>>::ok(buffer.first(block.unwrap().size()));
+        }
         virtual Result<void> writeBlock(uint64_t blockID, std::vector<uint8_t>& data) = 0;
+
+        /**
+         * @brief Reads `buffer.size()` bytes at `offset` within a block, e.g. one file's tail in a shared block.
+         *
+         * The default reads the whole block; providers override it to read only the range.
+         */
+        virtual Result<void> readBlockRange(const uint64_t blockID, const uint64_t offset, const std::span<uint8_t> buffer) {
+            if (offset > getBlockSize() || buffer.size() > getBlockSize() - offset) {
+                return Result<void>::err(ErrorKind::InvalidArgument, "Range extends past the block");
+            }
+            auto block = readBlock(blockID);
+            if (block.is_err()) return Result<void>::err(block.unwrap_err());
+            std::copy_n(block.unwrap().begin() + static_cast<ptrdiff_t>(offset), buffer.size(), buffer.begin());
+            return Result<void>::ok();
+        }
+
+        /**
+         * @brief Writes `data` at `offset` within a block, leaving the rest of the block as it was.
+         *
+         * The default reads the block, patches it and writes it back, so a torn write may also damage
+         * the rest of the block, and two concurrent range writes to one block can each write back the
+         * other's range as it was, losing one of them. Callers sharing a block serialise their writes to
+         * it, e.g. with `FileLockTable::lock_block`; providers override it to write only the range.
+         */
+        virtual Result<void> writeBlockRange(const uint64_t blockID, const uint64_t offset, const std::span<const uint8_t> data) {
+            if (offset > getBlockSize() || data.size() > getBlockSize() - offset) {
+                return Result<void>::err(ErrorKind::InvalidArgument, "Range extends past the block");
+            }
+            auto block = readBlock(blockID);
+            if (block.is_err()) return Result<void>::err(block.unwrap_err());
+            std::copy(data.begin(), data.end(), block.unwrap().begin() + static_cast<ptrdiff_t>(offset));
+            return writeBlock(blockID, block.unwrap());
+        }
+
         [[nodiscard]] virtual uint64_t getBlockCount() const = 0;
         [[nodiscard]] virtual uint64_t getBlockSize() const = 0;
     };
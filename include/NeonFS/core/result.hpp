@@ -1,4 +1,6 @@
 #pragma once
+#include <functional>
+#include <memory>
 #include <optional>
 #include <stdexcept>
 #include <variant>
@@ -11,6 +13,8 @@ namespace neonfs {
     class Result;
     template<>
     class Result<void>;
+    template<typename T>
+    class Result<T&>;
 
     template<typename T>
     class Result {
@@ -19,10 +23,28 @@ namespace neonfs {
             return Result<T>(std::move(value));
         }
 
-        [[nodiscard]] static Result<T> err(const std::string &message, const int code = 0) {
+        // Allocates to own the message; prefer a literal or an ErrorKind on paths that can fail repeatedly.
+        // A template only so that a literal prefers the `StaticText` overload.
+        template<typename = void>
+        [[nodiscard]] static Result<T> err(const std::string& message, const int code = 0) {
             return Result<T>(Error{message, code});
         }
 
+        // Stores the literal by pointer, without allocating; arrays that are not constants do not compile
+        [[nodiscard]] static Result<T> err(const StaticText message, const int code = 0) noexcept {
+            return Result<T>(Error{message, code});
+        }
+
+        // A writable buffer is copied, like a std::string
+        template<size_t N>
+        [[nodiscard]] static Result<T> err(char (&buffer)[N], const int code = 0) {
+            return Result<T>(Error{buffer, code});
+        }
+
+        [[nodiscard]] static Result<T> err(const ErrorKind kind, const StaticText context = {}, const int code = 0) noexcept {
+            return Result<T>(Error{kind, context, code});
+        }
+
         [[nodiscard]] static Result<T> err(Error error) {
             return Result<T>(std::move(error));
         }
@@ -32,21 +54,21 @@ namespace neonfs {
 
         T& unwrap() {
             if (is_err()) {
-                throw std::runtime_error("Attempted to unwrap error result: " + std::get<Error>(data_).message);
+                throw std::runtime_error("Attempted to unwrap error result: " + std::string(std::get<Error>(data_).message()));
             }
             return std::get<T>(data_);
         }
 
         const T& unwrap() const {
             if (is_err()) {
-                throw std::runtime_error("Attempted to unwrap error result: " + std::get<Error>(data_).message);
+                throw std::runtime_error("Attempted to unwrap error result: " + std::string(std::get<Error>(data_).message()));
             }
             return std::get<T>(data_);
         }
 
         T unwrap_move() {
             if (is_err()) {
-                throw std::runtime_error("Attempted to unwrap error result: " + std::get<Error>(data_).message);
+                throw std::runtime_error("Attempted to unwrap error result: " + std::string(std::get<Error>(data_).message()));
             }
             return std::move(std::get<T>(data_));
         }
@@ -78,13 +100,29 @@ namespace neonfs {
             );
         }
 
-        T unwrap_or(T default_val) const {
-            return is_ok() ? std::get<T>(data_) : default_val;
+        // Chain combinators come in lvalue and rvalue forms. Called on a temporary, as in
+        // `read().and_then(decrypt).map(parse)`, they move the value or error along instead of copying it.
+
+        [[nodiscard]] T unwrap_or(T default_val) const& {
+            if (is_ok()) return std::get<T>(data_);
+            return default_val;
+        }
+
+        [[nodiscard]] T unwrap_or(T default_val) && {
+            if (is_ok()) return std::move(std::get<T>(data_));
+            return default_val;
         }
 
         template<typename F> requires std::invocable<F, Error>
-        T unwrap_or_else(F&& f) {
-            return is_ok() ? std::get<T>(data_) : f(std::get<Error>(data_));
+        [[nodiscard]] T unwrap_or_else(F&& f) & {
+            if (is_ok()) return std::get<T>(data_);
+            return std::forward<F>(f)(std::get<Error>(data_));
+        }
+
+        template<typename F> requires std::invocable<F, Error>
+        [[nodiscard]] T unwrap_or_else(F&& f) && {
+            if (is_ok()) return std::move(std::get<T>(data_));
+            return std::forward<F>(f)(std::move(std::get<Error>(data_)));
         }
 
         std::optional<std::reference_wrapper<T>> try_unwrap() {
@@ -100,54 +138,91 @@ namespace neonfs {
         }
 
         template<typename F>
-        auto and_then(F&& f) {
-            if (is_err()) return std::invoke_result_t<F, T>::err(std::get<Error>(data_));
-            return std::forward<F>(f)(std::get<T>(data_));
-        }
+        [[nodiscard]] auto and_then(F&& f) & { return and_then_impl(*this, std::forward<F>(f)); }
 
         template<typename F>
-        auto map(F&& f) {
-            using ResultType = std::invoke_result_t<F, T>;
+        [[nodiscard]] auto and_then(F&& f) const& { return and_then_impl(*this, std::forward<F>(f)); }
 
-            if (is_err()) {
-                return Result<ResultType>::err(std::get<Error>(data_));
-            }
+        template<typename F>
+        [[nodiscard]] auto and_then(F&& f) && { return and_then_impl(std::move(*this), std::forward<F>(f)); }
 
-            if constexpr (std::is_void_v<ResultType>) {
-                std::forward<F>(f)(std::get<T>(data_));
-                return Result<void>::ok();
-            } else {
-                return Result<ResultType>::ok(std::forward<F>(f)(std::get<T>(data_)));
-            }
-        }
+        template<typename F>
+        [[nodiscard]] auto map(F&& f) & { return map_impl(*this, std::forward<F>(f)); }
+
+        template<typename F>
+        [[nodiscard]] auto map(F&& f) const& { return map_impl(*this, std::forward<F>(f)); }
+
+        template<typename F>
+        [[nodiscard]] auto map(F&& f) && { return map_impl(std::move(*this), std::forward<F>(f)); }
 
         template<typename F>
-        Result<T> map_err(F&& f) {
+        [[nodiscard]] Result<T> map_err(F&& f) & {
             if (is_ok()) return *this;
             return Result<T>::err(f(std::get<Error>(data_))); // Apply `f` to the error
         }
 
         template<typename F>
-        Result<T> or_else(F&& f) {
+        [[nodiscard]] Result<T> map_err(F&& f) && {
+            if (is_ok()) return std::move(*this);
+            return Result<T>::err(f(std::move(std::get<Error>(data_))));
+        }
+
+        template<typename F>
+        [[nodiscard]] Result<T> or_else(F&& f) & {
             if (is_ok()) return *this;
             return f(std::get<Error>(data_));  // Get the error from the variant (we know it has value)
         }
 
+        template<typename F>
+        [[nodiscard]] Result<T> or_else(F&& f) && {
+            if (is_ok()) return std::move(*this);
+            return f(std::move(std::get<Error>(data_)));
+        }
+
         template<typename U>
         bool contains(const U& value) const {
             return is_ok() && std::get<T>(data_) == value;
         }
 
         // Transform to std::optional
-        [[nodiscard]] std::optional<T> to_optional() const {
+        [[nodiscard]] std::optional<T> to_optional() const& {
             if (is_err()) return std::nullopt;
             return std::get<T>(data_);
         }
 
+        [[nodiscard]] std::optional<T> to_optional() && {
+            if (is_err()) return std::nullopt;
+            return std::move(std::get<T>(data_));
+        }
+
     private:
         explicit Result(T value) : data_(std::move(value)) {}
         explicit Result(Error error) : data_(std::move(error)) {}
 
+        // `std::get` on the forwarded variant yields T&, const T& or T&& to match how `self` was passed
+        template<typename Self, typename F>
+        static auto and_then_impl(Self&& self, F&& f) {
+            using ResultType = std::invoke_result_t<F, decltype(std::get<T>(std::forward<Self>(self).data_))>;
+            if (self.is_err()) return ResultType::err(std::get<Error>(std::forward<Self>(self).data_));
+            return std::forward<F>(f)(std::get<T>(std::forward<Self>(self).data_));
+        }
+
+        template<typename Self, typename F>
+        static auto map_impl(Self&& self, F&& f) {
+            using ResultType = std::invoke_result_t<F, decltype(std::get<T>(std::forward<Self>(self).data_))>;
+
+            if (self.is_err()) {
+                return Result<ResultType>::err(std::get<Error>(std::forward<Self>(self).data_));
+            }
+
+            if constexpr (std::is_void_v<ResultType>) {
+                std::forward<F>(f)(std::get<T>(std::forward<Self>(self).data_));
+                return Result<ResultType>::ok();
+            } else {
+                return Result<ResultType>::ok(std::forward<F>(f)(std::get<T>(std::forward<Self>(self).data_)));
+            }
+        }
+
         std::variant<T, Error> data_;
     };
 
@@ -159,10 +234,27 @@ namespace neonfs {
             return Result<void>(std::monostate{});
         }
 
+        // Allocates to own the message; prefer a literal or an ErrorKind on paths that can fail repeatedly.
+        // A template only so that a literal prefers the `StaticText` overload.
+        template<typename = void>
         [[nodiscard]] static Result<void> err(const std::string& message, const int code = 0) {
             return Result<void>(Error{message, code});
         }
 
+        // Stores the literal by pointer, without allocating; arrays that are not constants do not compile
+        [[nodiscard]] static Result<void> err(const StaticText message, const int code = 0) noexcept {
+            return Result<void>(Error{message, code});
+        }
+
+        template<size_t N>
+        [[nodiscard]] static Result<void> err(char (&buffer)[N], const int code = 0) {
+            return Result<void>(Error{buffer, code});
+        }
+
+        [[nodiscard]] static Result<void> err(const ErrorKind kind, const StaticText context = {}, const int code = 0) noexcept {
+            return Result<void>(Error{kind, context, code});
+        }
+
         [[nodiscard]] static Result<void> err(Error error) {
             return Result<void>(std::move(error));
         }
@@ -172,7 +264,7 @@ namespace neonfs {
 
         void unwrap() const {
             if (is_err()) {
-                throw std::runtime_error("Attempted to unwrap error result: " + std::get<Error>(data_).message);
+                throw std::runtime_error("Attempted to unwrap error result: " + std::string(std::get<Error>(data_).message()));
             }
         }
 
@@ -220,13 +312,13 @@ namespace neonfs {
         }
 
         template<typename F>
-        auto and_then(F&& f) {
+        [[nodiscard]] auto and_then(F&& f) {
             if (is_err()) return std::invoke_result_t<F>::err(std::get<Error>(data_));
             return std::forward<F>(f)();
         }
 
         template<typename F>
-        auto map(F&& f) {
+        [[nodiscard]] auto map(F&& f) {
             using ResultType = std::invoke_result_t<F>;
 
             if (is_err()) {
@@ -242,21 +334,184 @@ namespace neonfs {
         }
 
         template<typename F>
-        Result<void> map_err(F&& f) {
+        [[nodiscard]] Result<void> map_err(F&& f) & {
             if (is_ok()) return *this;
             return Result<void>::err(f(std::get<Error>(data_)));
         }
 
         template<typename F>
-        Result<void> or_else(F&& f) {
+        [[nodiscard]] Result<void> map_err(F&& f) && {
+            if (is_ok()) return std::move(*this);
+            return Result<void>::err(f(std::move(std::get<Error>(data_))));
+        }
+
+        template<typename F>
+        [[nodiscard]] Result<void> or_else(F&& f) & {
             if (is_ok()) return *this;
             return f(std::get<Error>(data_));
         }
 
+        template<typename F>
+        [[nodiscard]] Result<void> or_else(F&& f) && {
+            if (is_ok()) return std::move(*this);
+            return f(std::move(std::get<Error>(data_)));
+        }
+
     private:
         explicit Result(std::monostate) : data_(std::monostate{}) {}
         explicit Result(Error error) : data_(std::move(error)) {}
 
         std::variant<std::monostate, Error> data_;
     };
+
+    /**
+     * @brief Result that borrows its value: a reference to an object owned elsewhere, or an Error.
+     *
+     * Lets zero-copy APIs such as cached block lookups return borrowed data through the standard
+     * error type. The referent must outlive the result and every reference taken from it. Like a
+     * pointer, constness of the result does not propagate to the referent; use `Result<const T&>`
+     * for read-only access. `cloned()` copies the referent into an owning `Result<T>`.
+     *
+     * For contiguous buffers, `Result<std::span<T>>` uses the primary template and borrows the same way.
+     */
+    template<typename T>
+    class Result<T&> {
+    public:
+        [[nodiscard]] static Result<T&> ok(T& value) noexcept {
+            return Result<T&>(std::addressof(value));
+        }
+
+        // A borrowed result must not bind to a temporary
+        static Result<T&> ok(std::remove_cvref_t<T>&&) = delete;
+
+        template<typename = void>
+        [[nodiscard]] static Result<T&> err(const std::string& message, const int code = 0) {
+            return Result<T&>(Error{message, code});
+        }
+
+        [[nodiscard]] static Result<T&> err(const StaticText message, const int code = 0) noexcept {
+            return Result<T&>(Error{message, code});
+        }
+
+        template<size_t N>
+        [[nodiscard]] static Result<T&> err(char (&buffer)[N], const int code = 0) {
+            return Result<T&>(Error{buffer, code});
+        }
+
+        [[nodiscard]] static Result<T&> err(const ErrorKind kind, const StaticText context = {}, const int code = 0) noexcept {
+            return Result<T&>(Error{kind, context, code});
+        }
+
+        [[nodiscard]] static Result<T&> err(Error error) {
+            return Result<T&>(std::move(error));
+        }
+
+        [[nodiscard]] bool is_ok() const { return std::holds_alternative<T*>(data_); }
+        [[nodiscard]] bool is_err() const { return std::holds_alternative<Error>(data_); }
+
+        T& unwrap() const {
+            if (is_err()) {
+                throw std::runtime_error("Attempted to unwrap error result: " + std::string(std::get<Error>(data_).message()));
+            }
+            return *std::get<T*>(data_);
+        }
+
+        [[nodiscard]] const Error& unwrap_err() const {
+            if (is_ok()) {
+                throw std::runtime_error("Attempted to unwrap_err on ok result");
+            }
+            return std::get<Error>(data_);
+        }
+
+        [[nodiscard]] const Error& expect_err(const std::string& msg) const {
+            if (is_ok()) {
+                throw std::runtime_error(msg);
+            }
+            return std::get<Error>(data_);
+        }
+
+        [[nodiscard]] T& unwrap_or(T& fallback) const {
+            return is_ok() ? *std::get<T*>(data_) : fallback;
+        }
+
+        // `f` must return a reference that outlives the result
+        template<typename F> requires std::invocable<F, const Error&>
+        [[nodiscard]] T& unwrap_or_else(F&& f) const {
+            if (is_ok()) return *std::get<T*>(data_);
+            return std::forward<F>(f)(std::get<Error>(data_));
+        }
+
+        std::optional<std::reference_wrapper<T>> try_unwrap() const {
+            if (is_err()) return std::nullopt;
+            return std::ref(*std::get<T*>(data_));
+        }
+
+        // Copies the referent into an owning result
+        [[nodiscard]] Result<std::remove_const_t<T>> cloned() const {
+            if (is_err()) return Result<std::remove_const_t<T>>::err(std::get<Error>(data_));
+            return Result<std::remove_const_t<T>>::ok(*std::get<T*>(data_));
+        }
+
+        template<typename FOk, typename FErr>
+        auto match(FOk&& ok_fn, FErr&& err_fn) const {
+            using OkResult = decltype(ok_fn(std::declval<T&>()));
+            using ErrResult = decltype(err_fn(std::declval<const Error&>()));
+            static_assert(std::is_same_v<OkResult, ErrResult>,
+                "Both handlers must return the same type");
+
+            if (is_ok()) return std::forward<FOk>(ok_fn)(*std::get<T*>(data_));
+            return std::forward<FErr>(err_fn)(std::get<Error>(data_));
+        }
+
+        template<typename F>
+        [[nodiscard]] auto and_then(F&& f) const {
+            using ResultType = std::invoke_result_t<F, T&>;
+            if (is_err()) return ResultType::err(std::get<Error>(data_));
+            return std::forward<F>(f)(*std::get<T*>(data_));
+        }
+
+        // A callback returning a reference, e.g. to a member, yields another borrowed result
+        template<typename F>
+        [[nodiscard]] auto map(F&& f) const {
+            using ResultType = std::invoke_result_t<F, T&>;
+
+            if (is_err()) {
+                return Result<ResultType>::err(std::get<Error>(data_));
+            }
+
+            if constexpr (std::is_void_v<ResultType>) {
+                std::forward<F>(f)(*std::get<T*>(data_));
+                return Result<ResultType>::ok();
+            } else {
+                return Result<ResultType>::ok(std::forward<F>(f)(*std::get<T*>(data_)));
+            }
+        }
+
+        template<typename F>
+        [[nodiscard]] Result<T&> map_err(F&& f) const {
+            if (is_ok()) return *this;
+            return Result<T&>::err(f(std::get<Error>(data_)));
+        }
+
+        template<typename F>
+        [[nodiscard]] Result<T&> or_else(F&& f) const {
+            if (is_ok()) return *this;
+            return f(std::get<Error>(data_));
+        }
+
+        template<typename U>
+        bool contains(const U& value) const {
+            return is_ok() && *std::get<T*>(data_) == value;
+        }
+
+        [[nodiscard]] std::optional<std::reference_wrapper<T>> to_optional() const {
+            return try_unwrap();
+        }
+
+    private:
+        explicit Result(T* value) : data_(value) {}
+        explicit Result(Error error) : data_(std::move(error)) {}
+
+        std::variant<T*, Error> data_;
+    };
 } // namespace neonfs
@@ -1,25 +1,41 @@
 #pragma once
 #include <openssl/crypto.h>
+#include <algorithm>
 #include <memory>
 #include <limits>
 #include <new>
 #include <type_traits>
-#include <iostream>
+#include <stdexcept>
+#include "secure_heap.h"
+#include "secure_heap_stats.h"
+#include "secure_slab_pool.h"
 
 namespace neonfs {
-	inline void initialize_secure_heap(const size_t size = 64 * 1024 * 1024, const size_t min_allocation = 64) {
-		if (!CRYPTO_secure_malloc_initialized()) {
-			if (!CRYPTO_secure_malloc_init(size, min_allocation)) {
+	inline void initialize_secure_heap(const SecureHeapConfig& config, const size_t min_allocation = 64) {
+		SecureHeap::initialize(config);
+		if (config.openssl_heap_size && !CRYPTO_secure_malloc_initialized()) {
+			if (!CRYPTO_secure_malloc_init(config.openssl_heap_size, min_allocation)) {
 				throw std::runtime_error("Failed to initialize OpenSSL secure heap");
 			}
 		}
 	}
 
+	// Grows on demand up to `size` bytes of secure memory
+	inline void initialize_secure_heap(const size_t size = 64 * 1024 * 1024, const size_t min_allocation = 64) {
+		SecureHeapConfig config;
+		config.max_size = size;
+		config.region_size = std::min(config.region_size, size);
+		initialize_secure_heap(config, min_allocation);
+	}
+
 	inline void cleanup_secure_heap() {
-		if (CRYPTO_secure_malloc_initialized()) {
-			if (!CRYPTO_secure_malloc_done()) {
-				throw std::runtime_error("Failed to shut down OpenSSL secure heap — possibly still in use");
-			}
+		// Slabs hold secure heap memory until every block in them has been returned
+		SecureSlabPool::release();
+		if (SecureHeap::initialized() && !SecureHeap::shutdown()) {
+			throw std::runtime_error("Failed to shut down secure heap — possibly still in use");
+		}
+		if (CRYPTO_secure_malloc_initialized() && !CRYPTO_secure_malloc_done()) {
+			throw std::runtime_error("Failed to shut down OpenSSL secure heap — possibly still in use");
 		}
 	}
 
@@ -51,16 +67,25 @@ namespace neonfs {
 
 			if (n > max_size()) throw std::bad_alloc();
 
-			if (!CRYPTO_secure_malloc_initialized()) throw std::runtime_error("OpenSSL secure heap not initialized");
+			if (!SecureHeap::initialized()) {
+				SecureHeapStats::record_failure();
+				throw std::runtime_error("Secure heap not initialized");
+			}
 
 			const std::size_t total_bytes = n * sizeof(T);
 
-			void* p = OPENSSL_secure_malloc(total_bytes);
+			// Small requests come from per-thread slab caches instead of the secure heap's locks
+			const bool pooled = SecureSlabPool::serves(total_bytes);
+			void* p = pooled ? SecureSlabPool::allocate(total_bytes) : SecureHeap::allocate(total_bytes);
 			if (!p) {
-				std::cout << "Failed to allocate " << total_bytes << " bytes" << std::endl;
+				// The heap is exhausted; SecureHeapStats::snapshot() shows what it is being used for
+				SecureHeapStats::record_failure();
 				throw std::bad_alloc();
 			}
 
+			SecureHeapStats::record_allocation(total_bytes);
+			if (!pooled) SecureHeapStats::record_heap_growth();
+
 			return static_cast<T*>(p);
 		}
 
@@ -68,7 +93,13 @@ namespace neonfs {
 		{
 			if (!p) return;
 			const std::size_t total_bytes = n * sizeof(T);
-			OPENSSL_secure_clear_free(p, total_bytes); // Wipe + free
+			SecureHeapStats::record_deallocation(total_bytes);
+			if (SecureSlabPool::serves(total_bytes)) {
+				SecureSlabPool::deallocate(p, total_bytes); // Wipe + return to the thread cache
+				return;
+			}
+			OPENSSL_cleanse(p, total_bytes); // Wipe + free
+			SecureHeap::deallocate(p, total_bytes);
 		}
 
 		[[nodiscard]] std::size_t max_size() noexcept
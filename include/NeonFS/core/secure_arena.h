@@ -0,0 +1,108 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace neonfs {
+    /**
+     * @brief Bump allocator over one secure-heap chunk, for the temporaries of a single request.
+     *
+     * The arena takes one chunk from `SecureHeap` up front and hands out memory by advancing a
+     * pointer. Individual frees are ignored, except that freeing the most recent allocation rolls the
+     * pointer back, so a growing vector can reuse its old space. Destroying or resetting the arena wipes
+     * everything that was handed out and returns the chunk in one call.
+     *
+     * If a request outgrows the chunk, the arena takes another chunk instead of failing. An arena is
+     * not thread-safe; use one per request or per thread.
+     */
+    class SecureArena final : public std::pmr::memory_resource {
+        struct Chunk {
+            uint8_t* data;
+            size_t size;
+            size_t used;
+        };
+        std::vector<Chunk> chunks_;
+        size_t capacity_;
+
+        Chunk& add_chunk(size_t minimum);
+    public:
+        static constexpr size_t default_capacity = 16 * 1024;
+
+        /**
+         * @brief Takes a chunk of `capacity` bytes from the secure heap.
+         * @throws std::bad_alloc if the secure heap is exhausted or not initialized.
+         */
+        explicit SecureArena(size_t capacity = default_capacity);
+        ~SecureArena() override;
+
+        SecureArena(const SecureArena&) = delete;
+        SecureArena& operator=(const SecureArena&) = delete;
+
+        // Wipes everything handed out and rewinds to an empty first chunk; extra chunks are released
+        void reset() noexcept;
+
+        [[nodiscard]] size_t capacity() const;
+        [[nodiscard]] size_t used() const;
+        [[nodiscard]] size_t chunk_count() const;
+
+    protected:
+        void* do_allocate(size_t bytes, size_t alignment) override;
+        void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+        [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+    };
+
+    /**
+     * @brief Stateful counterpart of `secure_allocator<T>` that allocates from a `SecureArena`.
+     *
+     * Containers using it must not outlive their arena. For type-erased use, pass the arena to a
+     * `std::pmr::polymorphic_allocator` instead.
+     */
+    template<typename T>
+    class secure_arena_allocator
+    {
+        static_assert(std::is_trivially_destructible_v<T>,
+            "secure_arena_allocator requires trivially destructible types to guarantee secure wiping.");
+
+        template<typename U>
+        friend class secure_arena_allocator;
+
+        SecureArena* arena_;
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using propagate_on_container_copy_assignment = std::false_type;
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap = std::true_type;
+
+        explicit secure_arena_allocator(SecureArena& arena) noexcept : arena_(&arena) {}
+
+        template<typename U>
+        secure_arena_allocator(const secure_arena_allocator<U>& other) noexcept : arena_(other.arena_) {}
+
+        [[nodiscard]] T* allocate(const std::size_t n)
+        {
+            if (n > std::numeric_limits<std::size_t>::max() / sizeof(T)) throw std::bad_alloc();
+            return static_cast<T*>(arena_->allocate(n * sizeof(T), alignof(T)));
+        }
+
+        void deallocate(T* p, const std::size_t n) noexcept
+        {
+            arena_->deallocate(p, n * sizeof(T), alignof(T));
+        }
+
+        [[nodiscard]] SecureArena& arena() const noexcept { return *arena_; }
+
+        template<typename U>
+        bool operator==(const secure_arena_allocator<U>& other) const noexcept { return arena_ == other.arena_; }
+    };
+
+    template<typename T>
+    using arena_vector = std::vector<T, secure_arena_allocator<T>>;
+
+    using arena_bytes = arena_vector<uint8_t>;
+} // namespace neonfs
@@ -0,0 +1,93 @@
+#pragma once
+#include <cstddef>
+
+namespace neonfs {
+    struct SecureHeapConfig {
+        // Size of each region mapped on demand; rounded up to whole pages
+        size_t region_size = 16 * 1024 * 1024;
+
+        // Upper bound on the total size of all regions; allocations beyond it fail
+        size_t max_size = 64 * 1024 * 1024;
+
+        // Number of regions mapped up front
+        size_t initial_regions = 1;
+
+        // Empty regions kept mapped for reuse; further empty regions are unmapped as soon as they empty
+        size_t idle_regions = 1;
+
+        // Requests of at least this size get a dedicated huge-page region, cutting TLB misses on bulk
+        // buffers (0 disables). Falls back to transparent huge pages, then to regular pages.
+        size_t huge_page_threshold = 2 * 1024 * 1024;
+
+        // Size of OpenSSL's own secure heap, which libcrypto uses internally for key material (0 to skip)
+        size_t openssl_heap_size = 1024 * 1024;
+    };
+
+    /**
+     * @brief NeonFS-owned secure memory, grown in locked, guard-paged regions up to a configured limit.
+     *
+     * OpenSSL's secure heap is a single region fixed at initialization, which caps in-flight plaintext.
+     * `SecureHeap` maps regions on demand instead. Each region is:
+     *  - surrounded by inaccessible guard pages, so overruns fault instead of reaching other memory,
+     *  - locked in RAM (`mlock` / `VirtualLock`) so it is never swapped out,
+     *  - excluded from core dumps where the platform supports it (`MADV_DONTDUMP`).
+     *
+     * Requests of at least `huge_page_threshold` bytes go to separate regions backed by huge pages.
+     *
+     * Memory is handed out in 64-byte granules, first-fit within a region. Callers wipe what they used
+     * before freeing, so free memory always reads as zero and unmapped regions hold no secrets.
+     * `secure_allocator`, `SecureSlabPool` and `SecureArena` all allocate from here.
+     */
+    class SecureHeap {
+    public:
+        SecureHeap() = delete;
+        ~SecureHeap() = delete;
+        SecureHeap(const SecureHeap&) = delete;
+        SecureHeap& operator=(const SecureHeap&) = delete;
+
+        static constexpr size_t granule = 64;
+
+        /**
+         * @brief Maps the initial regions. Does nothing if the heap is already initialized.
+         * @throws std::runtime_error if the configuration is invalid or the initial regions cannot be mapped.
+         */
+        static void initialize(const SecureHeapConfig& config);
+
+        /**
+         * @brief Unmaps every region if nothing is allocated from them.
+         * @return False, leaving the heap untouched, if any memory is still in use.
+         */
+        static bool shutdown() noexcept;
+
+        [[nodiscard]] static bool initialized() noexcept;
+
+        /**
+         * @brief Allocates `bytes` of zeroed, 64-byte aligned secure memory.
+         * @return The memory, or nullptr if the heap is not initialized or would exceed its limit.
+         */
+        [[nodiscard]] static void* allocate(size_t bytes) noexcept;
+
+        // Returns memory to its region; the caller must already have wiped the bytes it wrote
+        static void deallocate(void* p, size_t bytes) noexcept;
+
+        // True if `p` points into a region of the heap
+        [[nodiscard]] static bool owns(const void* p) noexcept;
+
+        // Unmaps all empty regions, including the idle ones kept for reuse. Returns the bytes released.
+        static size_t trim() noexcept;
+
+        [[nodiscard]] static size_t used() noexcept;
+        [[nodiscard]] static size_t mapped() noexcept;
+        [[nodiscard]] static size_t limit() noexcept;
+        [[nodiscard]] static size_t region_count() noexcept;
+
+        // Regions whose lock failed, typically because RLIMIT_MEMLOCK is too low; they are still guarded
+        [[nodiscard]] static size_t unlocked_region_count() noexcept;
+
+        // Regions backed by huge pages, explicit (MAP_HUGETLB, MEM_LARGE_PAGES) or transparent
+        [[nodiscard]] static size_t huge_region_count() noexcept;
+
+        // Huge page size used for huge-page regions on this system
+        [[nodiscard]] static size_t huge_page_size() noexcept;
+    };
+} // namespace neonfs
@@ -0,0 +1,95 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace neonfs {
+    // Allocation counts attributed to one `SecureHeapTag`
+    struct SecureHeapTagStats {
+        std::string tag;
+        uint64_t allocations = 0;
+        uint64_t bytes_allocated = 0;
+        uint64_t failed_allocations = 0;
+    };
+
+    /**
+     * @brief Point-in-time view of secure heap usage, returned by `SecureHeapStats::snapshot()`.
+     *
+     * Counters are summed over all threads, including threads that have exited. They are read without
+     * stopping other threads, so a snapshot taken under load is approximate.
+     */
+    struct SecureHeapSnapshot {
+        static constexpr size_t size_buckets = 20;
+
+        size_t heap_size = 0;           // Limit the secure heap may grow to, 0 if not initialized
+        size_t heap_used = 0;           // Bytes the secure heap has handed out, including slabs and arenas
+        size_t heap_peak = 0;           // Highest heap_used seen whenever the heap grew
+        size_t heap_mapped = 0;         // Bytes of secure memory currently mapped, used or not
+        size_t regions = 0;
+        size_t unlocked_regions = 0;    // Regions that could not be locked in RAM; raise RLIMIT_MEMLOCK if not 0
+        size_t huge_regions = 0;        // Regions backed by huge pages, serving requests of at least huge_page_threshold
+        size_t slab_reserved = 0;       // Bytes held by SecureSlabPool slabs
+        size_t bytes_in_use = 0;        // Bytes requested through secure_allocator or SecureArena and not yet freed
+
+        uint64_t allocations = 0;
+        uint64_t deallocations = 0;
+        uint64_t failed_allocations = 0;
+
+        // Bucket i counts requests of up to `bucket_limit(i)` bytes; the last bucket has no upper bound
+        std::array<uint64_t, size_buckets> allocations_by_size{};
+
+        // Share of heap_used not holding live data: slab slack, size-class rounding, and cached blocks
+        double fragmentation = 0.0;
+
+        std::vector<SecureHeapTagStats> tags;
+
+        [[nodiscard]] static size_t bucket_limit(size_t bucket);
+    };
+
+    /**
+     * @brief Introspection for `SecureHeap` and the allocators built on it.
+     *
+     * `secure_allocator`, `SecureSlabPool` and `SecureArena` report into per-thread counters, so recording
+     * takes no lock. Use `snapshot()` to size the heap for a given concurrency level instead of guessing.
+     */
+    class SecureHeapStats {
+    public:
+        SecureHeapStats() = delete;
+        ~SecureHeapStats() = delete;
+        SecureHeapStats(const SecureHeapStats&) = delete;
+        SecureHeapStats& operator=(const SecureHeapStats&) = delete;
+
+        [[nodiscard]] static SecureHeapSnapshot snapshot();
+
+        // Restarts peak tracking from the current usage
+        static void reset_peak() noexcept;
+
+        // Successful allocations made by the calling thread so far; cheap enough for benchmarks
+        [[nodiscard]] static uint64_t thread_allocations() noexcept;
+
+        // Recording hooks used by the allocators
+        static void record_allocation(size_t bytes) noexcept;
+        static void record_deallocation(size_t bytes) noexcept;
+        static void record_failure() noexcept;
+        static void record_heap_growth() noexcept;
+    };
+
+    /**
+     * @brief Attributes the calling thread's secure allocations to a call site while in scope.
+     *
+     * Tags nest; the innermost one wins. The tag must outlive the scope, so pass a string literal.
+     * Only allocations are attributed, since a block may be freed far from where it was allocated.
+     * Each thread tracks up to 16 distinct tags; allocations under further tags are reported as "(other)".
+     */
+    class SecureHeapTag {
+        const char* previous_;
+    public:
+        explicit SecureHeapTag(const char* tag) noexcept;
+        ~SecureHeapTag();
+
+        SecureHeapTag(const SecureHeapTag&) = delete;
+        SecureHeapTag& operator=(const SecureHeapTag&) = delete;
+    };
+} // namespace neonfs
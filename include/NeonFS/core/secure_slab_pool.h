@@ -0,0 +1,60 @@
+#pragma once
+#include <cstddef>
+
+namespace neonfs {
+    /**
+     * @brief Thread-caching size-class allocator carved out of the secure heap.
+     *
+     * Allocating from `SecureHeap` takes a lock and searches a free list on every call, which serializes
+     * all threads doing crypto. The pool instead takes large slabs from the secure heap and
+     * splits them into fixed size classes (16 B to 4160 B, covering IVs, tags, keys and 4 KiB blocks with
+     * cipher slack). Each thread keeps a small cache of free blocks per class, so the common path never
+     * locks; only refilling or draining a cache touches the per-class depot.
+     *
+     * Blocks are wiped with `OPENSSL_cleanse` on free, and free lists are kept outside the blocks, so free
+     * secure memory always reads as zero. Slabs stay locked in the secure heap until `release()`.
+     */
+    class SecureSlabPool {
+    public:
+        SecureSlabPool() = delete;
+        ~SecureSlabPool() = delete;
+        SecureSlabPool(const SecureSlabPool&) = delete;
+        SecureSlabPool& operator=(const SecureSlabPool&) = delete;
+
+        // Largest request served from slabs; larger requests go straight to the secure heap
+        static constexpr size_t max_allocation = 4160;
+
+        [[nodiscard]] static constexpr bool serves(const size_t bytes) noexcept {
+            return bytes != 0 && bytes <= max_allocation;
+        }
+
+        // Size of the class a request of `bytes` is rounded up to, or 0 if the pool does not serve it
+        [[nodiscard]] static size_t size_class(size_t bytes) noexcept;
+
+        /**
+         * @brief Allocates a zeroed block for a request of `bytes` (which must satisfy `serves`).
+         * @return The block, or nullptr if the secure heap has no room for a new slab.
+         */
+        [[nodiscard]] static void* allocate(size_t bytes) noexcept;
+
+        // Wipes and returns a block; `bytes` must be the size it was allocated with
+        static void deallocate(void* p, size_t bytes) noexcept;
+
+        // Returns the calling thread's cached blocks to the shared depot. Threads do this on exit.
+        static void flush_thread_cache() noexcept;
+
+        /**
+         * @brief Returns every slab to the secure heap if none of their blocks is in use.
+         *
+         * Flushes the calling thread's cache first. Blocks cached by other running threads count as in use.
+         * @return True if all slabs were released.
+         */
+        static bool release() noexcept;
+
+        // Number of slabs currently taken from the secure heap
+        [[nodiscard]] static size_t slab_count() noexcept;
+
+        // Bytes currently taken from the secure heap for slabs
+        [[nodiscard]] static size_t reserved_bytes() noexcept;
+    };
+} // namespace neonfs
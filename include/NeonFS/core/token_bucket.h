@@ -0,0 +1,47 @@
+#pragma once
+#include <chrono>
+#include <mutex>
+
+namespace neonfs {
+    /**
+     * @brief Token-bucket rate limiter for background work such as re-encryption or scrubbing.
+     *
+     * Tokens accrue at `rate` per second up to `burst`. `acquire` blocks until enough tokens are
+     * available, so a loop that acquires its cost before each step runs at `rate` on average, with
+     * bursts of up to `burst`. A rate of 0 disables limiting.
+     */
+    class TokenBucket {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        /**
+         * @param rate Tokens added per second; 0 for unlimited.
+         * @param burst Bucket capacity. Requests larger than the burst still succeed, after waiting for the deficit.
+         */
+        explicit TokenBucket(double rate, double burst);
+
+        // Blocks until `tokens` are available, then takes them
+        void acquire(double tokens);
+
+        // Takes `tokens` if they are available now
+        [[nodiscard]] bool try_acquire(double tokens);
+
+        // Changes the rate for subsequent requests, e.g. to back off while foreground load is high
+        void set_rate(double rate);
+
+        [[nodiscard]] double rate();
+
+        TokenBucket(const TokenBucket&) = delete;
+        TokenBucket& operator=(const TokenBucket&) = delete;
+
+    private:
+        // Caller holds the lock
+        void refill(Clock::time_point now);
+
+        std::mutex mutex;
+        double rate_;
+        double burst;
+        double tokens;
+        Clock::time_point updated;
+    };
+} // namespace neonfs
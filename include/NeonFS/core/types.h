@@ -1,19 +1,16 @@
 #pragma once
 #include <chrono>
 #include <deque>
+#include <list>
 #include <map>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
+#include "error.h"
 #include "secure_allocator.hpp"
 
 namespace neonfs {
-    struct Error {
-        std::string message;
-        int code = 0;
-    };
-
     using secure_string = std::basic_string<char, std::char_traits<char>, secure_allocator<char>>;
     using secure_wstring = std::basic_string<wchar_t, std::char_traits<wchar_t>, secure_allocator<wchar_t>>;
 
@@ -50,6 +47,12 @@ namespace neonfs {
         uint64_t offset;                    // Offset in file
         std::vector<uint8_t> iv;            // Initialization vector for encryption
         std::vector<uint8_t> tag;           // Authentication tag (GCM)
+        uint64_t generation = 0;            // IV sequence counter; the IV is rebuilt from it when iv is empty
+        uint32_t keyVersion = 0;            // Version of the key the block is encrypted under
+        uint32_t blockCount = 1;            // Contiguous storage blocks from blockId holding the ciphertext
+        std::vector<uint8_t> inlineData{};  // Ciphertext kept in the metadata record instead; blockCount is then 0
+        bool packed = false;                // Ciphertext shares blockId with other files' tails, from packedOffset
+        uint32_t packedOffset = 0;          // Byte offset of the ciphertext within a packed block
     };
 
     /**
@@ -66,6 +69,10 @@ namespace neonfs {
         uint64_t parentId;                  // ID of the parent directory (0 for root)
 
         std::vector<BlockInfo> blocks;      // Ordered list of associated blocks (empty for directories)
+        uint32_t chunkBlocks = 1;           // Storage blocks per encryption chunk; each BlockInfo covers one chunk
+
+        std::vector<uint8_t> wrappedKey;    // Per-file data key wrapped under a master key (empty if none)
+        uint32_t wrappingKeyVersion = 0;    // Version of the master key that wrapped it
     };
 
 } // namespace neonfs
\ No newline at end of file
@@ -0,0 +1,39 @@
+#pragma once
+#include <NeonFS/core/interfaces.h>
+#include <map>
+#include <mutex>
+
+namespace neonfs::metadata {
+    /**
+     * @brief `IMetadataProvider` that keeps every record in memory.
+     *
+     * Intended for tests, tools and ephemeral volumes; nothing survives `shutdown`. The root
+     * directory has ID 0 and always exists. All methods are thread-safe.
+     */
+    class InMemoryMetadataProvider final : public IMetadataProvider {
+        std::mutex mutex;
+        std::map<uint64_t, Metadata> records;
+        uint64_t nextId = 1;
+
+        uint64_t create(const std::string &name, uint64_t parentId, uint32_t permissions, bool isDirectory);
+    public:
+        void initialize() override;
+        void shutdown() override;
+
+        void upsertMetadata(const Metadata &meta) override;
+
+        // Throws std::out_of_range if no record has this ID
+        Metadata getMetadata(uint64_t fileId) override;
+
+        void deleteMetadata(uint64_t fileId) override;
+        std::vector<uint64_t> listMetadataIds() override;
+        bool verifyMetadata(const Metadata &meta) override;
+        std::vector<Metadata> batchGetMetadata(const std::vector<uint64_t> &ids) override;
+        std::vector<Metadata> getChildren(uint64_t parentId) override;
+        bool isDirectoryEmpty(uint64_t directoryId) override;
+        void move(uint64_t fileId, uint64_t newParentId) override;
+        uint64_t createDirectory(const std::string &name, uint64_t parentId, uint32_t permissions) override;
+        uint64_t createFile(const std::string &name, uint64_t parentId, uint32_t permissions) override;
+        void rename(uint64_t fileId, const std::string &newName) override;
+    };
+} // namespace neonfs::metadata
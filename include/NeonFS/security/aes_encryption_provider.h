@@ -2,21 +2,42 @@
 #include <NeonFS/core/interfaces.h>
 #include <NeonFS/core/result.hpp>
 #include <NeonFS/security/aes_gcm_ctx_pool.h>
+#include <NeonFS/security/iv_sequence.h>
 #include <openssl/evp.h>
 
 namespace neonfs::security {
     class AESEncryptionProvider final : public IEncryptionProvider {
         std::shared_ptr<AESGCMCtxPool> contextPool_;
         secure_bytes key_;
+        std::shared_ptr<IVSequence> ivSequence_;
+
+        Result<secure_bytes> encrypt_with_iv(const secure_bytes& plain, const uint8_t* iv, secure_bytes& outTag);
+        Result<secure_bytes> decrypt_with_iv(const secure_bytes& cipher, const uint8_t* iv, const secure_bytes& tag);
     public:
         // Enforce move-only master_key in constructor
         // explicit prevents accidental conversions (from other types like std::vector<uint8_t>).
         explicit AESEncryptionProvider(secure_bytes &&master_key, const size_t poolMaxSize);
 
+        // With an IV sequence, empty IVs are filled from the counter instead of RAND_bytes.
+        AESEncryptionProvider(secure_bytes &&master_key, const size_t poolMaxSize, std::shared_ptr<IVSequence> ivSequence);
+
         Result<secure_bytes> encrypt(const secure_bytes& plain, secure_bytes& outIV, secure_bytes& outTag) override;
         Result<secure_bytes> decrypt(const secure_bytes& cipher, const secure_bytes& iv, secure_bytes& tag) override;
 
+        /**
+         * @brief Encrypts under the next counter of the IV sequence and reports it as a compact generation.
+         *
+         * The generation replaces the 12 raw IV bytes in `BlockInfo`; the IV is rebuilt from it on decryption.
+         * Fails if the provider was constructed without an IV sequence.
+         */
+        Result<secure_bytes> encrypt_with_generation(const secure_bytes& plain, uint64_t& outGeneration, secure_bytes& outTag);
+
+        /**
+         * @brief Decrypts data produced by `encrypt_with_generation`.
+         */
+        Result<secure_bytes> decrypt_with_generation(const secure_bytes& cipher, uint64_t generation, const secure_bytes& tag);
+
         size_t iv_size() const override;
         size_t tag_size() const override;
     };
-} // namespace neon::security
\ No newline at end of file
+} // namespace neon::security
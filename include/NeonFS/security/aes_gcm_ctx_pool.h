@@ -1,5 +1,6 @@
 #pragma once
 #include <NeonFS/security/aes_gcm_ctx.h>
+#include <condition_variable>
 #include <memory>
 #include <mutex>
 #include <stack>
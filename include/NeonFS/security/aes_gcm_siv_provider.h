@@ -0,0 +1,35 @@
+#pragma once
+#include <NeonFS/core/interfaces.h>
+#include <NeonFS/core/result.hpp>
+#include <NeonFS/security/aes_gcm_ctx_pool.h>
+#include <openssl/evp.h>
+
+namespace neonfs::security {
+    /**
+     * @brief AES-256-GCM-SIV (RFC 8452): nonce-misuse resistant AEAD.
+     *
+     * A repeated IV only reveals whether two plaintexts are equal instead of breaking confidentiality
+     * and authenticity as it does with GCM. The cipher is fetched from OpenSSL at runtime and requires
+     * OpenSSL 3.2 or later; check `is_available()` before constructing.
+     */
+    class AESGCMSIVProvider final : public IEncryptionProvider {
+        std::shared_ptr<AESGCMCtxPool> contextPool_;
+        secure_bytes key_;
+        EVP_CIPHER* cipher_ = nullptr;
+    public:
+        // Throws std::invalid_argument for a bad key and std::runtime_error if OpenSSL lacks AES-256-GCM-SIV.
+        explicit AESGCMSIVProvider(secure_bytes &&key, size_t poolMaxSize);
+        ~AESGCMSIVProvider() override;
+
+        AESGCMSIVProvider(const AESGCMSIVProvider&) = delete;
+        AESGCMSIVProvider& operator=(const AESGCMSIVProvider&) = delete;
+
+        static bool is_available();
+
+        Result<secure_bytes> encrypt(const secure_bytes& plain, secure_bytes& outIV, secure_bytes& outTag) override;
+        Result<secure_bytes> decrypt(const secure_bytes& cipher, const secure_bytes& iv, secure_bytes& tag) override;
+
+        size_t iv_size() const override;
+        size_t tag_size() const override;
+    };
+} // namespace neonfs::security
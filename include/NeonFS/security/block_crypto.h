@@ -0,0 +1,39 @@
+#pragma once
+#include <NeonFS/core/interfaces.h>
+#include <NeonFS/core/result.hpp>
+#include <NeonFS/core/types.h>
+#include <span>
+
+namespace neonfs::security {
+    /*
+     * Layout of a file's blocks, shared by everything that reads or rewrites them: each `BlockInfo`
+     * is one encryption chunk of `Metadata::chunkBlocks` storage blocks. Chunk i holds file bytes
+     * [i * chunk size, (i + 1) * chunk size), encrypted on its own, and its ciphertext is
+     * `block_cipher_length` bytes spread over the `BlockInfo::blockCount` storage blocks from `blockId`.
+     * A block with a `blockCount` of 0 is inline: its ciphertext is `BlockInfo::inlineData`. A packed
+     * block is the extent (`blockId`, `packedOffset`, `block_cipher_length`) of a block it shares.
+     */
+
+    // Bytes of file data per chunk
+    uint64_t chunk_size(const Metadata& meta, uint64_t blockSize);
+
+    // Length of the block's ciphertext; 0 if the block lies past the end of the file
+    size_t block_cipher_length(const Metadata& meta, const BlockInfo& block, uint64_t blockSize);
+
+    // Storage blocks needed for `cipherLength` bytes of ciphertext
+    uint32_t storage_blocks_for(size_t cipherLength, uint64_t blockSize);
+
+    // Reads the block's ciphertext from its storage blocks or extent, or from the metadata if it is inline
+    Result<secure_bytes> read_block_cipher(IStorageProvider& storage, const Metadata& meta, const BlockInfo& block);
+
+    // Writes a ciphertext to where `block` places it: its extent if packed, else its storage blocks from `blockId`
+    Result<void> write_block_cipher(IStorageProvider& storage, const BlockInfo& block, std::span<const uint8_t> cipher);
+
+    /**
+     * @brief Decrypts one block with its stored IV, or from its IV counter when it has none.
+     *
+     * Blocks without an IV were written through an IV sequence, so `provider` must then be an
+     * `AESEncryptionProvider`.
+     */
+    Result<secure_bytes> decrypt_block(IEncryptionProvider& provider, const BlockInfo& block, const secure_bytes& cipher);
+} // namespace neonfs::security
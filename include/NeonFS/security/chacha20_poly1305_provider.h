@@ -0,0 +1,21 @@
+#pragma once
+#include <NeonFS/core/interfaces.h>
+#include <NeonFS/core/result.hpp>
+#include <NeonFS/security/aes_gcm_ctx_pool.h>
+#include <openssl/evp.h>
+
+namespace neonfs::security {
+    // ChaCha20-Poly1305 (RFC 8439) for hosts without hardware AES, where it outruns AES-256-GCM.
+    class ChaCha20Poly1305Provider final : public IEncryptionProvider {
+        std::shared_ptr<AESGCMCtxPool> contextPool_;
+        secure_bytes key_;
+    public:
+        explicit ChaCha20Poly1305Provider(secure_bytes &&key, size_t poolMaxSize);
+
+        Result<secure_bytes> encrypt(const secure_bytes& plain, secure_bytes& outIV, secure_bytes& outTag) override;
+        Result<secure_bytes> decrypt(const secure_bytes& cipher, const secure_bytes& iv, secure_bytes& tag) override;
+
+        size_t iv_size() const override;
+        size_t tag_size() const override;
+    };
+} // namespace neonfs::security
@@ -0,0 +1,106 @@
+#pragma once
+#include <NeonFS/core/interfaces.h>
+#include <NeonFS/core/result.hpp>
+#include <NeonFS/security/encryption_provider_factory.h>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace neonfs::security {
+    /**
+     * @brief Envelope encryption: random per-file data keys, wrapped with AES-256-KW under a master key.
+     *
+     * Block data is encrypted under the file's data key, and only the 40-byte wrapped key is stored,
+     * in `Metadata::wrappedKey` together with the master key version that wrapped it. Rotating the
+     * master key therefore rewraps one small blob per file instead of re-encrypting every block.
+     *
+     * The manager holds a keyring of master key versions. New data keys are wrapped under the current
+     * version; older versions stay available for unwrapping until every file has been rewrapped and the
+     * version is retired.
+     *
+     * Providers for unwrapped data keys are cached per file in LRU order, so repeated access to a hot
+     * file costs no unwrap. All methods are thread-safe.
+     */
+    class DataKeyManager {
+    public:
+        static constexpr size_t data_key_size = 32;
+        static constexpr size_t wrapped_key_size = data_key_size + 8;
+
+        /**
+         * @param version Version number of `master_key`, stored with every key it wraps.
+         * @param master_key A 32-byte key-encryption key; the manager takes ownership.
+         * @param suite Cipher suite of the per-file providers.
+         * @param cache_capacity Maximum number of files whose unwrapped keys are cached.
+         * @param poolMaxSize Maximum number of concurrent cipher contexts per file provider.
+         * @throws std::invalid_argument if the master key is not 32 bytes or the capacity is 0.
+         */
+        DataKeyManager(uint32_t version, secure_bytes &&master_key, CipherSuite suite = CipherSuite::AES_256_GCM,
+                       size_t cache_capacity = 1024, size_t poolMaxSize = 2);
+
+        /**
+         * @brief Adds a master key version to the keyring without making it current.
+         * @return An error if the key is not 32 bytes or the version is already present.
+         */
+        Result<void> add_master_key(uint32_t version, secure_bytes &&master_key);
+
+        /**
+         * @brief Makes a version in the keyring the one new and rewrapped keys are wrapped under.
+         */
+        Result<void> set_current_version(uint32_t version);
+
+        // Removes a master key from the keyring. The current version cannot be retired.
+        Result<void> retire_master_key(uint32_t version);
+
+        [[nodiscard]] uint32_t current_version();
+
+        /**
+         * @brief Generates a random data key for a new file and stores it, wrapped, in `meta`.
+         * @return An error if `meta` already has a data key.
+         */
+        Result<void> assign_data_key(Metadata& meta);
+
+        /**
+         * @brief Returns an encryption provider keyed with the file's data key, unwrapping it on a cache miss.
+         */
+        Result<std::shared_ptr<IEncryptionProvider>> provider_for(const Metadata& meta);
+
+        /**
+         * @brief Rewraps the file's data key under the current master key. Block data is untouched.
+         * @return True if `meta` changed and must be persisted, false if it was already current.
+         */
+        Result<bool> rewrap(Metadata& meta);
+
+        // Drops the cached provider of one file, e.g. when it is deleted
+        void evict(uint64_t fileId);
+        void clear_cache();
+        [[nodiscard]] size_t cached_count();
+
+        // AES-256-KW (RFC 3394) of a key whose size is a multiple of 8 and at least 16 bytes
+        static Result<std::vector<uint8_t>> wrap_key(const secure_bytes& kek, const secure_bytes& key);
+        static Result<secure_bytes> unwrap_key(const secure_bytes& kek, const std::vector<uint8_t>& wrapped);
+
+        DataKeyManager(const DataKeyManager&) = delete;
+        DataKeyManager& operator=(const DataKeyManager&) = delete;
+
+    private:
+        struct CacheEntry {
+            std::shared_ptr<IEncryptionProvider> provider;
+            std::vector<uint8_t> wrappedKey;    // Detects a file ID reused with a different key
+            std::list<uint64_t>::iterator position;
+        };
+
+        Result<secure_bytes> unwrap_for(const Metadata& meta);
+
+        std::mutex mutex;
+        std::map<uint32_t, secure_bytes> keyring;
+        uint32_t currentVersion;
+        const CipherSuite suite;
+        const size_t cacheCapacity;
+        const size_t poolMaxSize;
+
+        std::unordered_map<uint64_t, CacheEntry> cache;
+        std::list<uint64_t> lru;                  // Most recently used first
+    };
+} // namespace neonfs::security
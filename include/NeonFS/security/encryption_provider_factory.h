@@ -0,0 +1,68 @@
+#pragma once
+#include <NeonFS/core/interfaces.h>
+#include <NeonFS/core/result.hpp>
+#include <memory>
+#include <optional>
+
+namespace neonfs::security {
+    enum class CipherSuite {
+        AES_256_GCM,
+        CHACHA20_POLY1305,
+        AES_256_GCM_SIV,
+    };
+
+    class EncryptionProviderFactory {
+    public:
+        /**
+         * @brief Reports whether the CPU has AES instructions (AES-NI on x86, ARMv8 crypto extensions on ARM).
+         *
+         * Returns std::nullopt on platforms where detection is not implemented.
+         */
+        static std::optional<bool> has_hardware_aes();
+
+        /**
+         * @brief Reports whether the linked OpenSSL implements the cipher suite.
+         */
+        static bool is_supported(CipherSuite suite);
+
+        /**
+         * @brief Measures single-threaded encryption throughput of a cipher suite in bytes per second.
+         *
+         * Uses a throwaway random key and `sample_size`-byte messages for roughly `duration_ms` milliseconds.
+         */
+        static Result<double> measure_throughput(CipherSuite suite, size_t sample_size, unsigned duration_ms);
+
+        /**
+         * @brief Picks the fastest safe cipher suite for this host.
+         *
+         * With hardware AES, AES-256-GCM is chosen; without it, ChaCha20-Poly1305. When CPU features
+         * cannot be detected, both are benchmarked once and the result is cached for the process.
+         * When `misuse_resistant` is set, AES-256-GCM-SIV is required and an error is returned if unsupported.
+         *
+         * The chosen suite must be persisted with the volume: data can only be decrypted with the suite
+         * that encrypted it.
+         */
+        static Result<CipherSuite> select_cipher_suite(bool misuse_resistant);
+
+        /**
+         * @brief Creates a provider for an explicit cipher suite.
+         * @param key A 32-byte key; the provider takes ownership.
+         * @param poolMaxSize Maximum number of concurrent cipher contexts.
+         */
+        static Result<std::unique_ptr<IEncryptionProvider>> create(CipherSuite suite, secure_bytes &&key, size_t poolMaxSize);
+
+        /**
+         * @brief Creates a provider for the suite returned by `select_cipher_suite`.
+         * @param outSuite Receives the selected suite so it can be stored with the volume.
+         */
+        static Result<std::unique_ptr<IEncryptionProvider>> create_fastest(secure_bytes &&key, size_t poolMaxSize, bool misuse_resistant, CipherSuite& outSuite);
+
+        static const char* name(CipherSuite suite);
+
+        // Prevent instantiation
+        EncryptionProviderFactory() = delete;
+        ~EncryptionProviderFactory() = delete;
+        EncryptionProviderFactory(const EncryptionProviderFactory&) = delete;
+        EncryptionProviderFactory& operator=(const EncryptionProviderFactory&) = delete;
+    };
+} // namespace neonfs::security
@@ -0,0 +1,83 @@
+#pragma once
+#include <NeonFS/core/result.hpp>
+#include <array>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+namespace neonfs::security {
+    /**
+     * @brief Deterministic source of 96-bit GCM IVs.
+     *
+     * Each IV is a 32-bit fixed field followed by a 64-bit invocation counter (the deterministic
+     * construction of NIST SP 800-38D, section 8.2.1). Callers reserve counter values in batches
+     * per lane, so handing out an IV costs one uncontended lane lock instead of a DRBG call.
+     *
+     * Uniqueness holds only while a counter value is never reused under the same key and fixed field.
+     * Callers that persist keys must persist the high-water mark passed to the reservation callback
+     * and resume the sequence from it; counters below the mark may have been handed out already.
+     */
+    class IVSequence {
+    public:
+        static constexpr size_t iv_size = 12;
+
+        /**
+         * @brief Invoked with the new high-water mark before any counter below it is handed out.
+         *
+         * Returning an error aborts the reservation, and the counters are not used.
+         */
+        using ReserveCallback = std::function<Result<void>(uint64_t highWaterMark)>;
+
+        /**
+         * @param fixedField Distinguishes independent writers sharing one key (e.g. node or key epoch).
+         * @param start First counter value to hand out, normally the last persisted high-water mark.
+         * @param batchSize Number of counters a lane reserves at once. Must be greater than 0.
+         * @param onReserve Optional persistence hook for the high-water mark.
+         */
+        explicit IVSequence(uint32_t fixedField, uint64_t start = 1, uint64_t batchSize = 1024, ReserveCallback onReserve = {});
+
+        static std::shared_ptr<IVSequence> create(uint32_t fixedField, uint64_t start = 1, uint64_t batchSize = 1024, ReserveCallback onReserve = {});
+
+        /**
+         * @brief Returns the next unused counter value (the compact "generation" of a block).
+         */
+        Result<uint64_t> next();
+
+        /**
+         * @brief Writes the 12-byte IV for this sequence's fixed field and the given counter.
+         */
+        void make_iv(uint64_t counter, uint8_t* out) const;
+
+        static void make_iv(uint32_t fixedField, uint64_t counter, uint8_t* out);
+
+        [[nodiscard]] uint32_t fixed_field() const;
+
+        /**
+         * @brief Every counter below this value may have been handed out.
+         */
+        [[nodiscard]] uint64_t high_water_mark();
+
+        IVSequence(const IVSequence&) = delete;
+        IVSequence& operator=(const IVSequence&) = delete;
+
+    private:
+        static constexpr size_t lane_count = 16;
+
+        struct alignas(64) Lane {
+            std::mutex mutex;
+            uint64_t next = 0;
+            uint64_t end = 0;
+        };
+
+        Result<void> reserve(Lane& lane);
+
+        const uint32_t fixedField_;
+        const uint64_t batchSize_;
+        ReserveCallback onReserve_;
+
+        std::mutex reserveMutex_;
+        uint64_t highWaterMark_;
+
+        std::array<Lane, lane_count> lanes_;
+    };
+} // namespace neonfs::security
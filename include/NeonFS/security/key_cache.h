@@ -0,0 +1,79 @@
+#pragma once
+#include <NeonFS/core/result.hpp>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace neonfs::security {
+    /**
+     * @brief Short-lived cache of unlocked master keys, keyed by volume.
+     *
+     * Unlocking a volume runs the password KDF, which is deliberately slow. Remounts and concurrent
+     * opens of an unlocked volume can take the key from here instead. Keys live in the secure heap,
+     * so they are locked in RAM and wiped when they expire, are evicted, or the cache is destroyed.
+     *
+     * An entry expires `ttl` after it was stored; reading it does not extend its life. Expired entries
+     * are wiped on the next access to the cache, or explicitly with `purge_expired`.
+     */
+    class KeyCache {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        /**
+         * @param ttl How long a key stays usable after it is stored. Must be greater than 0.
+         * @param capacity The maximum number of cached volumes; storing another evicts the entry expiring first.
+         */
+        explicit KeyCache(std::chrono::milliseconds ttl, size_t capacity = 64);
+        ~KeyCache();
+
+        // Stores a copy of `key`, replacing and wiping any key already cached for the volume
+        void put(const std::string& volume, const secure_bytes& key);
+
+        // A copy of the cached key, or `std::nullopt` if there is none or it has expired
+        [[nodiscard]] std::optional<secure_bytes> get(const std::string& volume);
+
+        /**
+         * @brief Returns the cached key, or runs `unlock` and caches its result on a miss.
+         *
+         * `unlock` runs without the cache lock held, so slow derivations for different volumes proceed
+         * in parallel. Concurrent misses on one volume run a single `unlock`: the others wait for it and
+         * take its key. Errors are returned as they are and not cached; if the running unlock fails, a
+         * waiter runs its own, since it may hold a different password.
+         */
+        Result<secure_bytes> get_or_unlock(const std::string& volume, const std::function<Result<secure_bytes>()>& unlock);
+
+        // Wipes the key of one volume, e.g. when it is locked or unmounted. Returns false if none was cached.
+        bool evict(const std::string& volume);
+
+        void clear();
+        size_t purge_expired();
+
+        [[nodiscard]] size_t size();
+        [[nodiscard]] std::chrono::milliseconds ttl() const;
+
+        KeyCache(const KeyCache&) = delete;
+        KeyCache& operator=(const KeyCache&) = delete;
+
+    private:
+        struct Entry {
+            secure_bytes key;
+            Clock::time_point expires;
+        };
+
+        // Caller holds the lock
+        void put_locked(const std::string& volume, const secure_bytes& key, Clock::time_point now);
+        size_t purge_expired_locked(Clock::time_point now);
+
+        std::mutex mutex;
+        std::condition_variable unlockFinished;
+        std::unordered_map<std::string, Entry> entries;
+        std::unordered_set<std::string> unlocking;      // Volumes with an `unlock` running in get_or_unlock
+        const std::chrono::milliseconds ttl_;
+        const size_t capacity;
+    };
+} // namespace neonfs::security
@@ -1,12 +1,30 @@
 #pragma once
 #include <NeonFS/core/types.h>
 #include <NeonFS/core/result.hpp>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <string_view>
 
 namespace neonfs::security {
     using namespace neonfs;
     enum class KeyDerivationAlgorithm {
         PBKDF2_HMAC_SHA256,
         PBKDF2_HMAC_SHA512,
+        ARGON2ID,           // Takes its costs from Argon2Params, see the Argon2Params overloads
+    };
+
+    /**
+     * @brief Cost parameters for Argon2id (RFC 9106).
+     *
+     * `memory_kib`, `iterations` and `lanes` are part of the derived key and must be stored with the salt.
+     * `threads` only controls how many lanes are computed at once and never changes the result.
+     */
+    struct Argon2Params {
+        uint32_t memory_kib = 64 * 1024;    // Memory cost in KiB, at least 8 * lanes
+        uint32_t iterations = 3;            // Passes over the memory
+        uint32_t lanes = 4;                 // Degree of parallelism
+        uint32_t threads = 0;               // Threads computing the lanes, 0 for one per lane
     };
 
     class KeyManager {
@@ -74,6 +92,99 @@ namespace neonfs::security {
          */
         static Result<bool> verify_password(const secure_bytes& password, const secure_bytes& salt, const secure_bytes& expected_derived_key, size_t derived_key_size, KeyDerivationAlgorithm algorithm, unsigned iterations);
 
+        /**
+         * @brief Picks a PBKDF2 iteration count that takes about `target` to derive a key on this machine.
+         *
+         * Times derivations on the calling thread until a measurement lasts long enough to be stable,
+         * then scales the measured rate to the target. The result reflects an idle machine; see
+         * `kdf_bench` for the cost under concurrent unlocks.
+         *
+         * @param target The desired derivation latency, for example 250 ms.
+         * @param algorithm `PBKDF2_HMAC_SHA256` or `PBKDF2_HMAC_SHA512`.
+         * @return A Result object containing the iteration count, or an error message on failure.
+         */
+        static Result<unsigned> calibrate_pbkdf2(std::chrono::milliseconds target, KeyDerivationAlgorithm algorithm);
+
+        /**
+         * @brief Whether the linked OpenSSL provides Argon2id (OpenSSL 3.2 or newer).
+         */
+        static bool argon2_available();
+
+        /**
+         * @brief Derives a key from a password and salt with Argon2id.
+         *
+         * The lanes are filled on up to `params.threads` threads from OpenSSL's thread pool. If the pool
+         * cannot supply them, the lanes are computed on the calling thread, with the same result.
+         *
+         * @param password The input password used to derive the key.
+         * @param salt A cryptographic salt of at least 8 bytes.
+         * @param derived_key_size The size of the derived key in bytes, at least 4.
+         * @param params The Argon2id cost parameters.
+         * @return A Result object containing the derived key as `secure_bytes` on success, or an error message
+         *         on failure or if Argon2id is not available.
+         */
+        static Result<secure_bytes> derive_key(const secure_bytes& password, const secure_bytes& salt, size_t derived_key_size, const Argon2Params& params);
+
+        /**
+         * @brief Verifies a password against a key derived with Argon2id, comparing in constant time.
+         *
+         * @param password The input password to verify.
+         * @param salt The salt used to create `expected_derived_key`.
+         * @param expected_derived_key The expected derived key to compare against.
+         * @param derived_key_size The size of the derived key in bytes, must match the expected key size.
+         * @param params Must match the cost parameters used to create the expected key; `threads` may differ.
+         * @return A Result object containing `true` if the password matches, `false` if it does not, or an error message on failure.
+         */
+        static Result<bool> verify_password(const secure_bytes& password, const secure_bytes& salt, const secure_bytes& expected_derived_key, size_t derived_key_size, const Argon2Params& params);
+
+        /**
+         * @brief Picks Argon2id parameters that take about `target` to derive a key on this machine.
+         *
+         * Times single passes over `memory_kib` with `lanes` lanes, one thread per lane, and sets `iterations`
+         * to as many passes as fit in the target. If a single pass is already too slow, the memory is halved
+         * until it fits, down to 8 MiB.
+         *
+         * @param target The desired derivation latency, for example the acceptable unlock delay.
+         * @param memory_kib The memory cost to start from, in KiB.
+         * @param lanes The degree of parallelism, usually the number of cores available for unlocking.
+         * @return A Result object containing the calibrated parameters, or an error message on failure.
+         */
+        static Result<Argon2Params> calibrate_argon2(std::chrono::milliseconds target, uint32_t memory_kib, uint32_t lanes);
+
+        /**
+         * @brief Derives a subkey of `master_key` for one purpose with HKDF-SHA256 (RFC 5869).
+         *
+         * Costs a few HMAC calls, so per-file or per-purpose keys can be derived on demand from an unlocked
+         * master key instead of running the password KDF again. Different labels or contexts give independent keys.
+         *
+         * @param master_key A uniformly random key, such as the output of `derive_key` or `generate_master_key`.
+         * @param label The purpose of the subkey, e.g. "neonfs/file". Must not be empty.
+         * @param context Distinguishes subkeys with the same purpose, e.g. a file ID; may be empty.
+         * @param subkey_size The size of the subkey in bytes, at most 255 * 32.
+         * @return A Result object containing the subkey as `secure_bytes` on success, or an error message on failure.
+         */
+        static Result<secure_bytes> derive_subkey(const secure_bytes& master_key, std::string_view label, const secure_bytes& context, size_t subkey_size);
+
+        /**
+         * @brief Computes the value to store for checking a password later without storing the key itself.
+         *
+         * The verifier is an HKDF subkey of `derived_key`, so it reveals nothing about the key that encrypts data.
+         */
+        static Result<secure_bytes> make_verifier(const secure_bytes& derived_key);
+
+        /**
+         * @brief Derives the key from a password and checks it against a verifier from `make_verifier`, running the KDF once.
+         *
+         * Replaces calling `verify_password` and then `derive_key`, which runs the full KDF twice.
+         *
+         * @return A Result object containing the derived key if the password matches, `std::nullopt` if it does not,
+         *         or an error message on failure.
+         */
+        static Result<std::optional<secure_bytes>> verify_and_derive(const secure_bytes& password, const secure_bytes& salt, const secure_bytes& verifier, size_t derived_key_size, KeyDerivationAlgorithm algorithm, unsigned iterations);
+
+        // Argon2id counterpart of `verify_and_derive`
+        static Result<std::optional<secure_bytes>> verify_and_derive(const secure_bytes& password, const secure_bytes& salt, const secure_bytes& verifier, size_t derived_key_size, const Argon2Params& params);
+
         // Prevent instantiation
         KeyManager() = delete;
         ~KeyManager() = delete;
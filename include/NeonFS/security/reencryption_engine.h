@@ -0,0 +1,128 @@
+#pragma once
+#include <NeonFS/core/file_lock_table.h>
+#include <NeonFS/core/interfaces.h>
+#include <NeonFS/core/result.hpp>
+#include <NeonFS/core/token_bucket.h>
+#include <atomic>
+#include <functional>
+#include <map>
+#include <memory>
+#include <optional>
+#include <thread>
+
+namespace neonfs::security {
+    /**
+     * @brief Resumable position of a re-encryption job, persisted through `ReencryptionConfig::onCheckpoint`.
+     */
+    struct ReencryptionCheckpoint {
+        uint32_t targetVersion = 0;
+        uint64_t nextFileId = 0;            // Files with smaller IDs are done
+
+        /**
+         * @brief Undo record of the block being rewritten.
+         *
+         * It is persisted before the block is overwritten. After a crash, the block is committed if
+         * its new ciphertext authenticates, and restored from `oldCiphertext` otherwise, which also
+         * repairs a torn write.
+         */
+        struct PendingBlock {
+            uint64_t fileId = 0;
+            size_t blockIndex = 0;
+            BlockInfo before;
+            BlockInfo after;
+            std::vector<uint8_t> oldCiphertext;
+        };
+        std::optional<PendingBlock> pending;
+    };
+
+    struct ReencryptionConfig {
+        // Key version every block should end up under
+        uint32_t targetVersion = 0;
+
+        // Returns the provider for a key version; called once per version per run
+        std::function<Result<std::shared_ptr<IEncryptionProvider>>(uint32_t keyVersion)> resolveKey;
+
+        // Persists the checkpoint; an error stops the job before the block is touched. Without it a crash can lose a block.
+        std::function<Result<void>(const ReencryptionCheckpoint&)> onCheckpoint;
+
+        // Checkpoint from a previous run to resume from
+        std::optional<ReencryptionCheckpoint> resumeFrom;
+
+        double bytesPerSecond = 0;          // Storage bytes read plus written, 0 for unlimited
+        double blocksPerSecond = 0;         // Blocks re-encrypted, bounding CPU use; 0 for unlimited
+    };
+
+    struct ReencryptionProgress {
+        uint64_t filesScanned = 0;
+        uint64_t blocksReencrypted = 0;
+        uint64_t blocksSkipped = 0;         // Already under the target version, e.g. written by the foreground
+        uint64_t bytesReencrypted = 0;
+        bool finished = false;
+    };
+
+    /**
+     * @brief Online key rotation: re-encrypts every block of a volume under a new key while it stays in use.
+     *
+     * The engine walks the files in ID order. For every block not yet under the target version, it
+     * takes the file's exclusive lock from the shared `FileLockTable`, decrypts the block with the key
+     * of its `BlockInfo::keyVersion`, encrypts it under the target key with a fresh IV, writes it back
+     * and upserts the file's metadata with the new IV, tag and version. Foreground readers holding the
+     * shared lock therefore always see a block together with the IV, tag and version it was written with.
+     *
+     * A block is one encryption chunk of the file, laid out as in `block_crypto.h`, and is rewritten
+     * in place across all of its storage blocks. Blocks without an IV use the provider's IV sequence and must come from an
+     * `AESEncryptionProvider`.
+     */
+    class ReencryptionEngine {
+    public:
+        ReencryptionEngine(IMetadataProvider& metadata, IStorageProvider& storage, FileLockTable& locks, ReencryptionConfig config);
+        ~ReencryptionEngine();
+
+        /**
+         * @brief Runs the job on the calling thread until every block is under the target version, `stop` is called, or an error occurs.
+         */
+        Result<void> run();
+
+        // Runs the job on a background thread; collect the outcome with `wait`
+        void start();
+
+        // Asks the job to stop after the current block; `run` then returns successfully with `finished` false
+        void stop();
+
+        Result<void> wait();
+
+        [[nodiscard]] ReencryptionProgress progress() const;
+
+        // Changes the throttles of a running job, e.g. to back off under foreground load
+        void set_limits(double bytesPerSecond, double blocksPerSecond);
+
+        ReencryptionEngine(const ReencryptionEngine&) = delete;
+        ReencryptionEngine& operator=(const ReencryptionEngine&) = delete;
+
+    private:
+        Result<std::shared_ptr<IEncryptionProvider>> provider(uint32_t keyVersion);
+        Result<void> recover(const ReencryptionCheckpoint::PendingBlock& pending);
+        Result<void> reencrypt_file(uint64_t fileId);
+        Result<void> checkpoint();
+
+        IMetadataProvider& metadata;
+        IStorageProvider& storage;
+        FileLockTable& locks;
+        ReencryptionConfig config;
+        ReencryptionCheckpoint state;
+
+        TokenBucket bytesBucket;
+        TokenBucket blocksBucket;
+        std::map<uint32_t, std::shared_ptr<IEncryptionProvider>> providers;
+
+        std::atomic<bool> stopRequested{false};
+        std::atomic<uint64_t> filesScanned{0};
+        std::atomic<uint64_t> blocksReencrypted{0};
+        std::atomic<uint64_t> blocksSkipped{0};
+        std::atomic<uint64_t> bytesReencrypted{0};
+        std::atomic<bool> finished{false};
+
+        std::thread worker;
+        std::optional<Result<void>> outcome;
+    };
+} // namespace neonfs::security
@@ -0,0 +1,96 @@
+#pragma once
+#include <NeonFS/core/interfaces.h>
+#include <NeonFS/core/result.hpp>
+
+namespace neonfs::security {
+    /**
+     * @brief Segment layout shared by `StreamEncryptor` and `StreamDecryptor`.
+     *
+     * A stream is split into fixed-size plaintext segments. Segment `i` is encrypted under the IV
+     * `noncePrefix (7 bytes) || i (4 bytes, big-endian) || lastFlag (1 byte)`, which is the STREAM
+     * construction: segments cannot be reordered, dropped, or truncated without failing authentication.
+     * Each encrypted segment is stored as `ciphertext || tag`.
+     */
+    class StreamLayout {
+    public:
+        static constexpr size_t nonce_prefix_size = 7;
+        static constexpr size_t segment_iv_size = 12;
+
+        StreamLayout(size_t segmentSize, size_t tagSize);
+
+        [[nodiscard]] size_t segment_size() const;
+        [[nodiscard]] size_t encrypted_segment_size() const;
+
+        // Number of segments for a plaintext of the given size (an empty stream still has one final segment)
+        [[nodiscard]] uint64_t segment_count(uint64_t plaintextSize) const;
+
+        // Total encrypted size of a plaintext of the given size, excluding the header
+        [[nodiscard]] uint64_t ciphertext_size(uint64_t plaintextSize) const;
+
+        // Offset of an encrypted segment in the ciphertext, excluding the header
+        [[nodiscard]] uint64_t ciphertext_offset(uint64_t segmentIndex) const;
+
+        static void make_segment_iv(const uint8_t* noncePrefix, uint32_t segmentIndex, bool last, uint8_t* out);
+
+    private:
+        size_t segmentSize_;
+        size_t tagSize_;
+    };
+
+    /**
+     * @brief Encrypts a stream segment by segment, holding at most one segment in memory.
+     *
+     * Segments must be pushed in order. Every segment except the last must be exactly `segment_size()`
+     * bytes; the last may hold 0 to `segment_size()` bytes. The encryptor refuses further input once the
+     * last segment is written, so segment IVs are never reused.
+     */
+    class StreamEncryptor {
+        IEncryptionProvider* provider_;
+        StreamLayout layout_;
+        secure_bytes header_;
+        uint64_t nextSegment_ = 0;
+        bool finished_ = false;
+
+        StreamEncryptor(IEncryptionProvider& provider, StreamLayout layout, secure_bytes header);
+    public:
+        /**
+         * @brief Creates an encryptor with a fresh random nonce prefix.
+         *
+         * The provider must use 12-byte IVs and must outlive the encryptor.
+         */
+        static Result<StreamEncryptor> create(IEncryptionProvider& provider, size_t segmentSize);
+
+        // The nonce prefix; store it with the ciphertext, it is required for decryption
+        [[nodiscard]] const secure_bytes& header() const;
+        [[nodiscard]] const StreamLayout& layout() const;
+
+        /**
+         * @brief Encrypts the next segment and returns `ciphertext || tag`.
+         * @param plain The segment plaintext.
+         * @param last True for the final segment of the stream.
+         */
+        Result<secure_bytes> encrypt_segment(const secure_bytes& plain, bool last);
+
+        [[nodiscard]] bool finished() const;
+    };
+
+    /**
+     * @brief Decrypts any segment of a stream independently of the others.
+     *
+     * Callers locate segment `i` with `layout().ciphertext_offset(i)` and must pass `last = true`
+     * exactly for the final segment; a wrong flag fails authentication, which is what detects truncation.
+     */
+    class StreamDecryptor {
+        IEncryptionProvider* provider_;
+        StreamLayout layout_;
+        secure_bytes header_;
+
+        StreamDecryptor(IEncryptionProvider& provider, StreamLayout layout, secure_bytes header);
+    public:
+        static Result<StreamDecryptor> create(IEncryptionProvider& provider, size_t segmentSize, const secure_bytes& header);
+
+        [[nodiscard]] const StreamLayout& layout() const;
+
+        Result<secure_bytes> decrypt_segment(uint64_t segmentIndex, const secure_bytes& encryptedSegment, bool last);
+    };
+} // namespace neonfs::security
@@ -0,0 +1,42 @@
+#pragma once
+#include <NeonFS/core/result.hpp>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace neonfs::storage {
+    /**
+     * @brief Tracks which blocks of a storage provider are in use.
+     *
+     * The map is not persisted: the owner rebuilds it from the metadata at mount, so blocks that were
+     * allocated but never referenced by committed metadata, e.g. after a crash, are free again.
+     * Allocation is next-fit from the last allocated block.
+     */
+    class BlockAllocator {
+    public:
+        explicit BlockAllocator(uint64_t blockCount);
+
+        // A free block, marked used; ErrorKind::ResourceExhausted when none is left
+        Result<uint64_t> allocate();
+
+        // The first of `count` contiguous free blocks, all marked used; ErrorKind::ResourceExhausted when no run is long enough
+        Result<uint64_t> allocate(uint64_t count);
+
+        // Returns `blockId` to the free pool; releasing a free block is a no-op
+        void release(uint64_t blockId);
+        void release(uint64_t firstBlockId, uint64_t count);
+
+        // Marks a block referenced by existing metadata; false if it was already used or is out of range
+        bool mark_used(uint64_t blockId);
+
+        [[nodiscard]] bool is_used(uint64_t blockId) const;
+        [[nodiscard]] uint64_t free_count() const;
+        [[nodiscard]] uint64_t block_count() const noexcept;
+
+    private:
+        mutable std::mutex mutex;
+        std::vector<bool> used;
+        uint64_t freeBlocks;
+        uint64_t next = 0;
+    };
+} // namespace neonfs::storage
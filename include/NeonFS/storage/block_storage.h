@@ -24,7 +24,10 @@ namespace neonfs::storage {
         static Result<void> create(std::string path, BlockStorageConfig config);
 
         Result<std::vector<uint8_t>> readBlock(uint64_t blockID) override;
+        Result<std::span<uint8_t>> readBlockInto(uint64_t blockID, std::span<uint8_t> buffer) override;
         Result<void> writeBlock(uint64_t blockID, std::vector<uint8_t>& data) override;
+        Result<void> readBlockRange(uint64_t blockID, uint64_t offset, std::span<uint8_t> buffer) override;
+        Result<void> writeBlockRange(uint64_t blockID, uint64_t offset, std::span<const uint8_t> data) override;
         [[nodiscard]] uint64_t getBlockCount() const override;
         [[nodiscard]] uint64_t getBlockSize() const override;
 
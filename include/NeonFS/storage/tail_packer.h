@@ -0,0 +1,55 @@
+#pragma once
+#include <NeonFS/core/result.hpp>
+#include <NeonFS/storage/block_allocator.h>
+#include <cstdint>
+#include <map>
+#include <mutex>
+
+namespace neonfs::storage {
+    // A byte range of a storage block
+    struct Extent {
+        uint64_t blockId = 0;
+        uint32_t offset = 0;
+        uint32_t length = 0;
+    };
+
+    /**
+     * @brief Places short payloads, such as the tails of small files, side by side in shared blocks.
+     *
+     * Pack blocks come from `allocator` and return to it when their last extent is released. Like the
+     * allocator, the packer keeps its map in memory only; the owner rebuilds it from the metadata at
+     * mount with `mark_used`. New extents go into the first pack block with a large enough gap, so
+     * freed space is reused before another block is taken.
+     */
+    class TailPacker {
+    public:
+        TailPacker(BlockAllocator& allocator, uint64_t blockSize);
+
+        // Free space for `length` bytes, at most the block size; ErrorKind::ResourceExhausted when no block is left
+        Result<Extent> allocate(uint32_t length);
+
+        // Frees the extent, and its block once no other extent is left in it; unknown extents are ignored
+        void release(const Extent& extent);
+
+        // Records an extent of existing metadata; false if it overlaps another or its block is used otherwise
+        bool mark_used(const Extent& extent);
+
+        [[nodiscard]] uint64_t block_count() const;
+        [[nodiscard]] uint64_t used_bytes() const;
+
+    private:
+        struct Pack {
+            std::map<uint32_t, uint32_t> extents;   // Offset to length
+            uint64_t freeBytes = 0;
+        };
+
+        bool insert(Pack& pack, const Extent& extent);
+
+        BlockAllocator& allocator;
+        uint64_t blockSize;
+
+        mutable std::mutex mutex;
+        std::map<uint64_t, Pack> packs;
+        uint64_t usedBytes = 0;
+    };
+} // namespace neonfs::storage
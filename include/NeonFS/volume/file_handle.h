@@ -0,0 +1,55 @@
+#pragma once
+#include <NeonFS/core/result.hpp>
+#include <cstdint>
+#include <span>
+
+namespace neonfs::volume {
+    class Volume;
+
+    enum class SeekOrigin {
+        Begin,
+        Current,
+        End
+    };
+
+    /**
+     * @brief An open file of a `Volume`, with a cursor for sequential `read` and `write`.
+     *
+     * `pread` and `pwrite` leave the cursor alone and are safe to call from several threads on one
+     * handle. The cursor calls are not: give each thread its own handle, or use positional I/O.
+     * A handle is a view of the volume and must not outlive it.
+     */
+    class FileHandle {
+    public:
+        FileHandle(Volume& volume, uint64_t fileId) noexcept;
+
+        [[nodiscard]] uint64_t id() const noexcept;
+
+        // Reads at the cursor and advances it by the bytes read
+        Result<size_t> read(std::span<uint8_t> out);
+
+        // Writes at the cursor and advances it past the data
+        Result<size_t> write(std::span<const uint8_t> data);
+
+        Result<size_t> pread(std::span<uint8_t> out, uint64_t offset) const;
+        Result<size_t> pwrite(std::span<const uint8_t> data, uint64_t offset) const;
+
+        /**
+         * @brief Moves the cursor; it may move past the end of the file, and a later write there leaves a zero-filled gap.
+         * @return The new cursor position, or `ErrorKind::InvalidArgument` if it would be negative.
+         */
+        Result<uint64_t> seek(int64_t offset, SeekOrigin origin = SeekOrigin::Begin);
+        [[nodiscard]] uint64_t tell() const noexcept;
+
+        Result<uint64_t> size() const;
+        Result<void> truncate(uint64_t size) const;
+
+        // Writes the file's buffered writes to storage
+        Result<void> flush() const;
+
+    private:
+        Volume* volume;
+        uint64_t fileId;
+        uint64_t position = 0;
+    };
+} // namespace neonfs::volume
@@ -0,0 +1,197 @@
+#pragma once
+#include <NeonFS/core/file_lock_table.h>
+#include <NeonFS/core/interfaces.h>
+#include <NeonFS/core/result.hpp>
+#include <NeonFS/storage/block_allocator.h>
+#include <NeonFS/storage/tail_packer.h>
+#include <NeonFS/volume/file_handle.h>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace neonfs::volume {
+    struct VolumeConfig {
+        // Returns the provider for a key version; called once per version while mounted
+        std::function<Result<std::shared_ptr<IEncryptionProvider>>(uint32_t keyVersion)> resolveKey;
+
+        // Key version new and rewritten blocks are encrypted under
+        uint32_t keyVersion = 0;
+
+        // Storage blocks of small writes held in memory across the volume; 0 writes everything through
+        size_t writeBufferBlocks = 0;
+
+        // Storage blocks per encryption chunk of files created without a chunk size of their own
+        uint32_t chunkBlocks = 1;
+
+        // Files of at most this many bytes, and at most one chunk, are stored inline in their metadata; 0 disables it
+        uint64_t inlineThreshold = 0;
+
+        // Chunks shorter than a block and of at most this many bytes share blocks with other tails; 0 disables it
+        uint64_t packThreshold = 0;
+    };
+
+    /**
+     * @brief Encrypted files on top of a storage, an encryption and a metadata provider.
+     *
+     * Files are encrypted in chunks of `Metadata::chunkBlocks` storage blocks, chosen per file at
+     * `create`. Chunk i holds file bytes [i * chunk size, (i + 1) * chunk size), encrypted on its own
+     * with a fresh IV under the volume's current key version, and is stored in a contiguous run of
+     * storage blocks. Large chunks suit large sequential files: they amortize the IV, the tag and the
+     * per-call crypto cost, while a small file keeps one block per chunk. Reads decrypt each chunk
+     * with the key of its own `BlockInfo::keyVersion`, so a volume stays readable while a
+     * `ReencryptionEngine` rotates it.
+     *
+     * A file no larger than `VolumeConfig::inlineThreshold` keeps its single chunk's ciphertext in its
+     * metadata record instead, so reading it costs no storage I/O and no padded block. It moves to
+     * storage when it outgrows the threshold, and back when it shrinks below it.
+     *
+     * With `VolumeConfig::packThreshold`, a short last chunk, the tail of a file, is packed with the
+     * tails of other files into a shared block as its own extent, encrypted with its own IV and tag.
+     * Extents are written with `IStorageProvider::writeBlockRange`, so writing one never rewrites the
+     * others in its block.
+     *
+     * `pread` holds the file's shared lock in `locks`, and `pwrite` and `truncate` hold its exclusive
+     * lock, so each call sees or replaces whole chunks together with their IVs and tags. Calls on
+     * different files run in parallel.
+     *
+     * Writes are copy-on-write: changed blocks are written to newly allocated storage blocks, the
+     * metadata is upserted, and only then are the replaced blocks released. A crash therefore leaves
+     * either the old or the new contents of every block; blocks written but never committed are free
+     * again at the next mount, which rebuilds the allocation map from the metadata.
+     *
+     * With `VolumeConfig::writeBufferBlocks`, a write that covers no whole chunk is kept in memory per
+     * chunk instead, and reads see it. Buffered writes reach storage at `flush`, or with the next
+     * write through to the same file, so many small writes into one chunk cost one read-modify-write
+     * cycle and one metadata update. Until then they are lost on a crash, as with a page cache.
+     */
+    class Volume {
+    public:
+        // Largest chunk; a chunk's plaintext and ciphertext are held in secure memory while it is rewritten
+        static constexpr uint64_t max_chunk_size = 4 * 1024 * 1024;
+
+        // Throws std::invalid_argument without a key resolver or with a chunk size out of range
+        Volume(IMetadataProvider& metadata, IStorageProvider& storage, FileLockTable& locks, VolumeConfig config);
+
+        // Flushes buffered writes; errors are ignored here, so call `flush` first to see them
+        ~Volume();
+
+        /**
+         * @brief Builds the allocation map from the metadata. Every other call fails with `ErrorKind::NotMounted` until it succeeds.
+         */
+        Result<void> mount();
+        [[nodiscard]] bool isMounted() const noexcept;
+
+        /**
+         * @brief Creates an empty file and opens it.
+         * @param chunkBlocks Storage blocks per encryption chunk of the file; 0 takes `VolumeConfig::chunkBlocks`.
+         */
+        Result<FileHandle> create(const std::string& name, uint64_t parentId, uint32_t permissions, uint32_t chunkBlocks = 0);
+        Result<FileHandle> open(uint64_t fileId);
+
+        // Deletes the file's metadata, then frees its blocks
+        Result<void> remove(uint64_t fileId);
+
+        /**
+         * @brief Reads up to `out.size()` bytes at `offset`.
+         * @return The number of bytes read, short only at the end of the file.
+         */
+        Result<size_t> pread(uint64_t fileId, std::span<uint8_t> out, uint64_t offset);
+
+        /**
+         * @brief Writes `data` at `offset`, growing the file if needed. A gap before `offset` reads as zeros.
+         * @return The number of bytes written, always `data.size()` on success.
+         */
+        Result<size_t> pwrite(uint64_t fileId, std::span<const uint8_t> data, uint64_t offset);
+
+        Result<void> truncate(uint64_t fileId, uint64_t size);
+        Result<uint64_t> size(uint64_t fileId);
+
+        // Writes the file's buffered writes to storage in one pass over its blocks
+        Result<void> flush(uint64_t fileId);
+
+        // Flushes every file; a file that fails keeps its buffered writes for a later attempt
+        Result<void> flush();
+
+        [[nodiscard]] size_t buffered_blocks() const noexcept;
+
+        // Switches the key version of later writes, e.g. when a rotation to that version starts
+        void set_key_version(uint32_t keyVersion) noexcept;
+        [[nodiscard]] uint32_t key_version() const noexcept;
+
+        [[nodiscard]] uint64_t free_blocks() const;
+
+        // Blocks holding packed tails
+        [[nodiscard]] uint64_t packed_blocks() const;
+
+        Volume(const Volume&) = delete;
+        Volume& operator=(const Volume&) = delete;
+
+    private:
+        // Bytes to store at `offset`
+        struct Patch {
+            uint64_t offset;
+            std::span<const uint8_t> data;
+        };
+
+        // Plaintext of one chunk with the byte ranges written to it, sorted and disjoint
+        struct BufferedBlock {
+            secure_bytes data;
+            std::vector<std::pair<uint32_t, uint32_t>> ranges;
+        };
+
+        // Changed only under the file's exclusive lock, so readers holding its shared lock may read it
+        struct BufferedFile {
+            uint64_t size = 0;
+            uint32_t chunkBlocks = 1;
+            std::map<uint64_t, BufferedBlock> blocks;
+        };
+
+        [[nodiscard]] bool valid_chunk(uint32_t chunkBlocks) const;
+        Result<Metadata> load(uint64_t fileId);
+        Result<std::shared_ptr<IEncryptionProvider>> provider(uint32_t keyVersion);
+        Result<secure_bytes> read_plain(const Metadata& meta, size_t index);
+
+        // Allocates room for a chunk's ciphertext, packed or in one run of blocks, and writes it there;
+        // ErrorKind::ResourceExhausted when no run is long enough, even if enough blocks are free
+        Result<void> store(BlockInfo& block, std::span<const uint8_t> cipher);
+
+        // Frees the storage of a block whose ciphertext is `cipherLength` bytes long; inline blocks have none
+        void release_block(const BlockInfo& block, size_t cipherLength);
+
+        // Re-encrypts the blocks `patches` touch, plus those a size change touches, and commits them.
+        // `patches` must be sorted by offset and must not overlap.
+        Result<void> rewrite(Metadata& meta, uint64_t newSize, std::span<const Patch> patches);
+
+        // Appends the buffered ranges below `limit`, minus [skipFrom, skipTo), in offset order
+        static void buffered_patches(const BufferedFile& buffer, uint64_t chunkSize, uint64_t skipFrom, uint64_t skipTo,
+                                     uint64_t limit, std::vector<Patch>& out);
+
+        BufferedFile* find_buffer(uint64_t fileId);
+        void drop_buffer(uint64_t fileId);
+        bool buffer_write(uint64_t fileId, const Metadata& meta, std::span<const uint8_t> data, uint64_t offset);
+        Result<void> flush_locked(uint64_t fileId);
+
+        IMetadataProvider& metadata;
+        IStorageProvider& storage;
+        FileLockTable& locks;
+        VolumeConfig config;
+        std::atomic<uint32_t> writeKeyVersion;
+
+        std::optional<neonfs::storage::BlockAllocator> allocator;
+        std::optional<neonfs::storage::TailPacker> packer;      // Uses allocator, so it is declared after it
+        std::mutex providersMutex;
+        std::map<uint32_t, std::shared_ptr<IEncryptionProvider>> providers;
+
+        std::mutex buffersMutex;            // Guards the map, not the buffered files in it
+        std::map<uint64_t, std::unique_ptr<BufferedFile>> buffers;
+        std::atomic<size_t> bufferedBlocks{0};
+    };
+} // namespace neonfs::volume
@@ -0,0 +1,62 @@
+#include <NeonFS/async/async_io.h>
+#include <NeonFS/async/work_stealing_executor.h>
+#include <stdexcept>
+
+neonfs::async::Task<neonfs::Result<std::vector<uint8_t>>> neonfs::async::read_block(IExecutor &executor, IStorageProvider &storage, const uint64_t blockId) {
+    co_await executor.schedule();
+    co_return storage.readBlock(blockId);
+}
+
+neonfs::async::Task<neonfs::Result<void>> neonfs::async::write_block(IExecutor &executor, IStorageProvider &storage, const uint64_t blockId, std::vector<uint8_t> data) {
+    co_await executor.schedule();
+    co_return storage.writeBlock(blockId, data);
+}
+
+neonfs::async::Task<neonfs::Result<neonfs::secure_bytes>> neonfs::async::encrypt(IExecutor &executor, IEncryptionProvider &provider, secure_bytes plain, secure_bytes &outIV, secure_bytes &outTag) {
+    co_await executor.schedule();
+    co_return provider.encrypt(plain, outIV, outTag);
+}
+
+neonfs::async::Task<neonfs::Result<neonfs::secure_bytes>> neonfs::async::decrypt(IExecutor &executor, IEncryptionProvider &provider, secure_bytes cipher, secure_bytes iv, secure_bytes tag) {
+    co_await executor.schedule();
+    co_return provider.decrypt(cipher, iv, tag);
+}
+
+neonfs::async::Task<neonfs::Result<neonfs::Metadata>> neonfs::async::get_metadata(IExecutor &executor, IMetadataProvider &metadata, const uint64_t fileId) {
+    co_await executor.schedule();
+    try {
+        co_return Result<Metadata>::ok(metadata.getMetadata(fileId));
+    } catch (const std::out_of_range&) {
+        co_return Result<Metadata>::err(ErrorKind::NotFound, "No metadata for file");
+    }
+}
+
+neonfs::async::Task<neonfs::Result<void>> neonfs::async::upsert_metadata(IExecutor &executor, IMetadataProvider &metadata, Metadata meta) {
+    co_await executor.schedule();
+    metadata.upsertMetadata(meta);
+    co_return Result<void>::ok();
+}
+
+neonfs::async::Task<neonfs::Result<std::vector<uint8_t>>> neonfs::async::read_block(IStorageProvider &storage, const uint64_t blockId) {
+    return read_block(WorkStealingExecutor::shared(), storage, blockId);
+}
+
+neonfs::async::Task<neonfs::Result<void>> neonfs::async::write_block(IStorageProvider &storage, const uint64_t blockId, std::vector<uint8_t> data) {
+    return write_block(WorkStealingExecutor::shared(), storage, blockId, std::move(data));
+}
+
+neonfs::async::Task<neonfs::Result<neonfs::secure_bytes>> neonfs::async::encrypt(IEncryptionProvider &provider, secure_bytes plain, secure_bytes &outIV, secure_bytes &outTag) {
+    return encrypt(WorkStealingExecutor::shared(), provider, std::move(plain), outIV, outTag);
+}
+
+neonfs::async::Task<neonfs::Result<neonfs::secure_bytes>> neonfs::async::decrypt(IEncryptionProvider &provider, secure_bytes cipher, secure_bytes iv, secure_bytes tag) {
+    return decrypt(WorkStealingExecutor::shared(), provider, std::move(cipher), std::move(iv), std::move(tag));
+}
+
+neonfs::async::Task<neonfs::Result<neonfs::Metadata>> neonfs::async::get_metadata(IMetadataProvider &metadata, const uint64_t fileId) {
+    return get_metadata(WorkStealingExecutor::shared(), metadata, fileId);
+}
+
+neonfs::async::Task<neonfs::Result<void>> neonfs::async::upsert_metadata(IMetadataProvider &metadata, Metadata meta) {
+    return upsert_metadata(WorkStealingExecutor::shared(), metadata, std::move(meta));
+}
@@ -0,0 +1,43 @@
+#include <NeonFS/async/thread_pool.h>
+#include <algorithm>
+
+neonfs::async::ThreadPool::ThreadPool(size_t threads) {
+    if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+    workers.reserve(threads);
+    for (size_t i = 0; i < threads; ++i) workers.emplace_back([this] { work(); });
+}
+
+neonfs::async::ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    available.notify_all();
+    for (auto& worker : workers) worker.join();
+}
+
+void neonfs::async::ThreadPool::post(const std::coroutine_handle<> handle) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        queue.push_back(handle);
+    }
+    available.notify_one();
+}
+
+size_t neonfs::async::ThreadPool::thread_count() const noexcept {
+    return workers.size();
+}
+
+void neonfs::async::ThreadPool::work() {
+    for (;;) {
+        std::coroutine_handle<> handle;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            available.wait(lock, [this] { return stopping || !queue.empty(); });
+            if (queue.empty()) return;  // Stopping and drained
+            handle = queue.front();
+            queue.pop_front();
+        }
+        handle.resume();
+    }
+}
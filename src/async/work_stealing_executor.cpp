@@ -0,0 +1,283 @@
+#include <NeonFS/async/work_stealing_executor.h>
+#include <algorithm>
+#include <cctype>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#if defined(_WIN32)
+#include <windows.h>
+#elif defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace {
+    struct Cpu {
+        int id;
+        int node;
+    };
+
+    struct Current {
+        const neonfs::async::WorkStealingExecutor* executor = nullptr;
+        size_t index = 0;
+    };
+
+    thread_local Current current;
+
+#if defined(__linux__)
+    // Parses a sysfs CPU list such as "0-3,8-11"
+    std::vector<int> parse_cpu_list(const std::string& list) {
+        std::vector<int> cpus;
+        std::stringstream ranges(list);
+        for (std::string range; std::getline(ranges, range, ',');) {
+            if (range.empty() || range == "\n") continue;
+            const auto dash = range.find('-');
+            const int first = std::stoi(range.substr(0, dash));
+            const int last = dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+            for (int cpu = first; cpu <= last; ++cpu) cpus.push_back(cpu);
+        }
+        return cpus;
+    }
+
+    std::map<int, int> node_of_cpus() {
+        std::map<int, int> nodes;
+        std::error_code ec;
+        for (const auto& entry : std::filesystem::directory_iterator("/sys/devices/system/node", ec)) {
+            const std::string name = entry.path().filename().string();
+            if (name.rfind("node", 0) != 0 || name.size() == 4 || !std::isdigit(static_cast<unsigned char>(name[4]))) continue;
+            std::ifstream file(entry.path() / "cpulist");
+            std::string list;
+            if (!std::getline(file, list)) continue;
+            try {
+                for (const int cpu : parse_cpu_list(list)) nodes[cpu] = std::stoi(name.substr(4));
+            } catch (const std::exception&) {
+                // An unreadable node leaves its CPUs on node 0
+            }
+        }
+        return nodes;
+    }
+#endif
+
+    // The CPUs this process may run on, with their NUMA nodes
+    std::vector<Cpu> usable_cpus() {
+        std::vector<Cpu> cpus;
+#if defined(__linux__)
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+            const auto nodes = node_of_cpus();
+            for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+                if (!CPU_ISSET(cpu, &set)) continue;
+                const auto node = nodes.find(cpu);
+                cpus.push_back({cpu, node == nodes.end() ? 0 : node->second});
+            }
+        }
+#endif
+        if (cpus.empty()) {
+            const int count = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+            for (int cpu = 0; cpu < count; ++cpu) cpus.push_back({cpu, 0});
+        }
+        return cpus;
+    }
+
+    // Orders CPUs so that consecutive workers alternate between nodes
+    std::vector<Cpu> interleave_nodes(const std::vector<Cpu>& cpus) {
+        std::map<int, std::vector<Cpu>> byNode;
+        for (const auto& cpu : cpus) byNode[cpu.node].push_back(cpu);
+
+        std::vector<Cpu> order;
+        order.reserve(cpus.size());
+        for (size_t round = 0; order.size() < cpus.size(); ++round) {
+            for (const auto& [node, members] : byNode) {
+                if (round < members.size()) order.push_back(members[round]);
+            }
+        }
+        return order;
+    }
+
+    // Restricts the calling thread to `cpus`; placement is best effort, so failures are ignored
+    void bind_current_thread(const std::vector<int>& cpus) {
+#if defined(__linux__)
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        for (const int cpu : cpus) CPU_SET(cpu, &set);
+        pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#elif defined(_WIN32)
+        DWORD_PTR mask = 0;
+        for (const int cpu : cpus) {
+            if (cpu < static_cast<int>(sizeof(DWORD_PTR) * 8)) mask |= DWORD_PTR{1} << cpu;
+        }
+        if (mask) SetThreadAffinityMask(GetCurrentThread(), mask);
+#else
+        (void)cpus;
+#endif
+    }
+}
+
+neonfs::async::WorkStealingExecutor::WorkStealingExecutor(const WorkStealingConfig config) {
+    const std::vector<Cpu> cpus = usable_cpus();
+    const std::vector<Cpu> placement = config.numaAware ? interleave_nodes(cpus) : cpus;
+    const size_t threads = config.threads ? config.threads : cpus.size();
+
+    workers.reserve(threads);
+    for (size_t i = 0; i < threads; ++i) {
+        auto worker = std::make_unique<Worker>();
+        const Cpu& cpu = placement[i % placement.size()];
+        worker->node = config.numaAware ? cpu.node : 0;
+        worker->cpu = config.pinThreads ? cpu.id : -1;
+        workers.push_back(std::move(worker));
+    }
+
+    // Victims on the same node first, each list starting after the worker itself to spread thieves out
+    for (size_t i = 0; i < threads; ++i) {
+        for (size_t step = 1; step < threads; ++step) {
+            const size_t other = (i + step) % threads;
+            if (workers[other]->node == workers[i]->node) workers[i]->victims.push_back(other);
+        }
+        for (size_t step = 1; step < threads; ++step) {
+            const size_t other = (i + step) % threads;
+            if (workers[other]->node != workers[i]->node) workers[i]->victims.push_back(other);
+        }
+    }
+
+    // Workers on a multi-node machine stay on their node's CPUs even when not pinned
+    const bool multiNode = std::any_of(cpus.begin(), cpus.end(), [&](const Cpu& cpu) { return cpu.node != cpus.front().node; });
+    for (size_t i = 0; i < threads; ++i) {
+        std::vector<int> allowed;
+        if (workers[i]->cpu >= 0) {
+            allowed.push_back(workers[i]->cpu);
+        } else if (config.numaAware && multiNode) {
+            for (const auto& cpu : cpus) {
+                if (cpu.node == workers[i]->node) allowed.push_back(cpu.id);
+            }
+        }
+        workers[i]->thread = std::thread([this, i, allowed = std::move(allowed)] {
+            if (!allowed.empty()) bind_current_thread(allowed);
+            work(i);
+        });
+    }
+}
+
+neonfs::async::WorkStealingExecutor::~WorkStealingExecutor() {
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        stopping = true;
+    }
+    available.notify_all();
+    for (const auto& worker : workers) worker->thread.join();
+}
+
+void neonfs::async::WorkStealingExecutor::post(const std::coroutine_handle<> handle) {
+    const size_t index = current.executor == this
+        ? current.index
+        : nextExternal.fetch_add(1, std::memory_order_relaxed) % workers.size();
+    {
+        std::lock_guard<std::mutex> lock(workers[index]->mutex);
+        workers[index]->deque.push_back(handle);
+    }
+    pending.fetch_add(1);
+    wake();
+}
+
+size_t neonfs::async::WorkStealingExecutor::thread_count() const noexcept {
+    return workers.size();
+}
+
+std::optional<size_t> neonfs::async::WorkStealingExecutor::current_worker() const noexcept {
+    if (current.executor != this) return std::nullopt;
+    return current.index;
+}
+
+int neonfs::async::WorkStealingExecutor::node_of(const size_t index) const {
+    if (index >= workers.size()) throw std::out_of_range("Worker index out of range");
+    return workers[index]->node;
+}
+
+int neonfs::async::WorkStealingExecutor::cpu_of(const size_t index) const {
+    if (index >= workers.size()) throw std::out_of_range("Worker index out of range");
+    return workers[index]->cpu;
+}
+
+uint64_t neonfs::async::WorkStealingExecutor::steals() const noexcept {
+    return stolen.load(std::memory_order_relaxed);
+}
+
+neonfs::async::WorkStealingExecutor& neonfs::async::WorkStealingExecutor::shared() {
+    static WorkStealingExecutor executor;
+    return executor;
+}
+
+void neonfs::async::WorkStealingExecutor::work(const size_t index) {
+    current = {this, index};
+    for (;;) {
+        if (const auto handle = take(index)) {
+            handle.resume();
+            continue;
+        }
+
+        // `sleeping` is raised before `pending` is checked and `post` raises `pending` before checking
+        // `sleeping`, so a post either sees this worker asleep and wakes it, or the worker sees the post
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        sleeping.fetch_add(1);
+        available.wait(lock, [this] { return pending.load() > 0 || stopping.load(); });
+        sleeping.fetch_sub(1);
+        if (stopping.load() && pending.load() == 0) return;  // Stopping and drained
+    }
+}
+
+std::coroutine_handle<> neonfs::async::WorkStealingExecutor::take(const size_t index) {
+    Worker& self = *workers[index];
+    {
+        std::lock_guard<std::mutex> lock(self.mutex);
+        if (!self.deque.empty()) {
+            const auto handle = self.deque.front();
+            self.deque.pop_front();
+            pending.fetch_sub(1);
+            // More work than this worker can start now: let a sleeper steal some
+            if (!self.deque.empty()) wake();
+            return handle;
+        }
+    }
+    return steal(index);
+}
+
+std::coroutine_handle<> neonfs::async::WorkStealingExecutor::steal(const size_t index) {
+    Worker& self = *workers[index];
+    for (const size_t victimIndex : self.victims) {
+        Worker& victim = *workers[victimIndex];
+        std::deque<std::coroutine_handle<>> batch;
+        {
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (victim.deque.empty()) continue;
+            const auto half = static_cast<std::ptrdiff_t>((victim.deque.size() + 1) / 2);
+            batch.assign(victim.deque.end() - half, victim.deque.end());
+            victim.deque.erase(victim.deque.end() - half, victim.deque.end());
+        }
+        stolen.fetch_add(batch.size(), std::memory_order_relaxed);
+
+        const auto handle = batch.front();
+        batch.pop_front();
+        pending.fetch_sub(1);
+        if (!batch.empty()) {
+            {
+                std::lock_guard<std::mutex> lock(self.mutex);
+                self.deque.insert(self.deque.end(), batch.begin(), batch.end());
+            }
+            wake();
+        }
+        return handle;
+    }
+    return {};
+}
+
+void neonfs::async::WorkStealingExecutor::wake() {
+    if (sleeping.load() == 0) return;
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+    }
+    available.notify_one();
+}
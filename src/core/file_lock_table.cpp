@@ -0,0 +1,24 @@
+#include <NeonFS/core/file_lock_table.h>
+#include <bit>
+
+std::shared_lock<std::shared_mutex> neonfs::FileLockTable::lock_shared(const uint64_t fileId) {
+    return std::shared_lock<std::shared_mutex>(stripe(fileId));
+}
+
+std::unique_lock<std::shared_mutex> neonfs::FileLockTable::lock_exclusive(const uint64_t fileId) {
+    return std::unique_lock<std::shared_mutex>(stripe(fileId));
+}
+
+std::unique_lock<std::mutex> neonfs::FileLockTable::lock_block(const uint64_t blockId) {
+    return std::unique_lock<std::mutex>(blockStripes[stripe_index(blockId)]);
+}
+
+size_t neonfs::FileLockTable::stripe_index(const uint64_t id) {
+    // Fibonacci hashing spreads sequential IDs over all stripes
+    constexpr int shift = 64 - std::bit_width(stripe_count - 1);
+    return static_cast<size_t>((id * 0x9E3779B97F4A7C15ull) >> shift);
+}
+
+std::shared_mutex &neonfs::FileLockTable::stripe(const uint64_t fileId) {
+    return stripes[stripe_index(fileId)];
+}
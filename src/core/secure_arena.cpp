@@ -0,0 +1,90 @@
+#include <NeonFS/core/secure_arena.h>
+#include <NeonFS/core/secure_heap.h>
+#include <NeonFS/core/secure_heap_stats.h>
+#include <openssl/crypto.h>
+#include <algorithm>
+
+neonfs::SecureArena::SecureArena(const size_t capacity) : capacity_(std::max<size_t>(capacity, 64)) {
+    add_chunk(capacity_);
+}
+
+neonfs::SecureArena::~SecureArena() {
+    // Only the bytes handed out can hold secrets, so wipe those rather than the whole chunk
+    for (const Chunk& chunk : chunks_) {
+        OPENSSL_cleanse(chunk.data, chunk.used);
+        SecureHeap::deallocate(chunk.data, chunk.size);
+        SecureHeapStats::record_deallocation(chunk.size);
+    }
+}
+
+neonfs::SecureArena::Chunk &neonfs::SecureArena::add_chunk(const size_t minimum) {
+    const size_t size = std::max(capacity_, minimum);
+    auto* data = static_cast<uint8_t*>(SecureHeap::allocate(size));
+    if (!data) {
+        SecureHeapStats::record_failure();
+        throw std::bad_alloc();
+    }
+    SecureHeapStats::record_allocation(size);
+    SecureHeapStats::record_heap_growth();
+
+    chunks_.push_back({data, size, 0});
+    return chunks_.back();
+}
+
+void neonfs::SecureArena::reset() noexcept {
+    for (size_t i = 0; i < chunks_.size(); ++i) {
+        OPENSSL_cleanse(chunks_[i].data, chunks_[i].used);
+        if (i > 0) {
+            SecureHeap::deallocate(chunks_[i].data, chunks_[i].size);
+            SecureHeapStats::record_deallocation(chunks_[i].size);
+        }
+    }
+    chunks_.resize(1);
+    chunks_.front().used = 0;
+}
+
+size_t neonfs::SecureArena::capacity() const {
+    size_t total = 0;
+    for (const Chunk& chunk : chunks_) total += chunk.size;
+    return total;
+}
+
+size_t neonfs::SecureArena::used() const {
+    size_t total = 0;
+    for (const Chunk& chunk : chunks_) total += chunk.used;
+    return total;
+}
+
+size_t neonfs::SecureArena::chunk_count() const {
+    return chunks_.size();
+}
+
+void *neonfs::SecureArena::do_allocate(const size_t bytes, const size_t alignment) {
+    Chunk* chunk = &chunks_.back();
+    auto offset = [&](const Chunk& c) {
+        const auto address = reinterpret_cast<uintptr_t>(c.data) + c.used;
+        return c.used + ((alignment - address % alignment) % alignment);
+    };
+
+    size_t start = offset(*chunk);
+    if (start + bytes > chunk->size) {
+        chunk = &add_chunk(bytes + alignment);
+        start = offset(*chunk);
+    }
+
+    chunk->used = start + bytes;
+    return chunk->data + start;
+}
+
+void neonfs::SecureArena::do_deallocate(void *p, const size_t bytes, size_t) {
+    // Only the most recent allocation can be handed back; anything else is wiped on reset or destruction
+    Chunk& chunk = chunks_.back();
+    if (static_cast<uint8_t*>(p) + bytes == chunk.data + chunk.used) {
+        OPENSSL_cleanse(p, bytes);
+        chunk.used -= bytes;
+    }
+}
+
+bool neonfs::SecureArena::do_is_equal(const std::pmr::memory_resource &other) const noexcept {
+    return this == &other;
+}
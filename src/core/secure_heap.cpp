@@ -0,0 +1,418 @@
+#include <NeonFS/core/secure_heap.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace {
+    enum class PageBacking {
+        Regular,
+        Transparent,    // madvise(MADV_HUGEPAGE); the kernel may still fall back to regular pages
+        Explicit,       // MAP_HUGETLB or MEM_LARGE_PAGES
+    };
+
+    struct Region {
+        uint8_t* mapping = nullptr;      // Including the guard pages
+        size_t mapping_size = 0;
+        uint8_t* base = nullptr;         // First usable byte
+        size_t size = 0;
+        bool locked = false;
+        bool bulk = false;               // Reserved for requests of at least huge_page_threshold
+        PageBacking backing = PageBacking::Regular;
+
+        std::mutex mutex;
+        std::map<size_t, size_t> free;   // Offset -> length, coalesced
+        size_t used = 0;
+
+        void* try_allocate(const size_t bytes) {
+            for (auto it = free.begin(); it != free.end(); ++it) {
+                if (it->second < bytes) continue;
+
+                const size_t offset = it->first;
+                const size_t remaining = it->second - bytes;
+                free.erase(it);
+                if (remaining) free.emplace(offset + bytes, remaining);
+                used += bytes;
+                return base + offset;
+            }
+            return nullptr;
+        }
+
+        void release(const size_t offset, size_t bytes) {
+            size_t start = offset;
+            auto next = free.lower_bound(offset);
+            if (next != free.end() && offset + bytes == next->first) {
+                bytes += next->second;
+                next = free.erase(next);
+            }
+            if (next != free.begin()) {
+                if (const auto prev = std::prev(next); prev->first + prev->second == offset) {
+                    start = prev->first;
+                    bytes += prev->second;
+                    free.erase(prev);
+                }
+            }
+            free.emplace(start, bytes);
+        }
+    };
+
+    struct State {
+        std::shared_mutex mutex;                         // Guards the region list and the configuration
+        std::vector<std::unique_ptr<Region>> regions;    // Sorted by base address
+        neonfs::SecureHeapConfig config;
+        std::atomic<bool> initialized{false};
+        std::atomic<size_t> used{0};
+        std::atomic<size_t> mapped{0};
+    };
+
+    // Never destroyed: secure containers may be freed during static destruction
+    State& state() {
+        static auto* instance = new State();
+        return *instance;
+    }
+
+    size_t page_size() {
+#if defined(_WIN32)
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        return info.dwPageSize;
+#else
+        return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#endif
+    }
+
+    size_t round_up(const size_t value, const size_t multiple) {
+        return (value + multiple - 1) / multiple * multiple;
+    }
+
+    size_t detect_huge_page_size() {
+#if defined(_WIN32)
+        if (const size_t minimum = GetLargePageMinimum()) return minimum;
+#elif defined(__linux__)
+        std::ifstream meminfo("/proc/meminfo");
+        std::string key;
+        size_t kib = 0;
+        while (meminfo >> key) {
+            if (key == "Hugepagesize:" && meminfo >> kib && kib) return kib * 1024;
+            meminfo.ignore(256, '\n');
+        }
+#endif
+        return 2 * 1024 * 1024;
+    }
+
+#if defined(_WIN32)
+    // Large pages need SeLockMemoryPrivilege and are never paged out, so they need no VirtualLock.
+    // They cannot be mixed with guard pages in one allocation, so these regions go without.
+    bool map_large_pages(Region& region) {
+        void* mapping = VirtualAlloc(nullptr, region.size, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+        if (!mapping) return false;
+        region.mapping = region.base = static_cast<uint8_t*>(mapping);
+        region.mapping_size = region.size;
+        region.locked = true;
+        region.backing = PageBacking::Explicit;
+        return true;
+    }
+#else
+    // Replaces the inaccessible `size` bytes at `base` with readable memory, preferring huge pages
+    bool map_huge_pages(Region& region) {
+#if defined(MAP_HUGETLB)
+        // Needs pages reserved in the hugetlb pool (vm.nr_hugepages), so this usually fails unless configured
+        if (mmap(region.base, region.size, PROT_READ | PROT_WRITE,
+                 MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED | MAP_HUGETLB, -1, 0) != MAP_FAILED) {
+            region.backing = PageBacking::Explicit;
+            return true;
+        }
+#endif
+        // A failed MAP_FIXED may already have replaced the reservation, so map over it rather than mprotect
+        if (mmap(region.base, region.size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0) == MAP_FAILED) {
+            return false;
+        }
+#if defined(MADV_HUGEPAGE)
+        // Before mlock, which faults the region in, so the faults can already allocate huge pages
+        if (madvise(region.base, region.size, MADV_HUGEPAGE) == 0) region.backing = PageBacking::Transparent;
+#endif
+        return true;
+    }
+#endif
+
+    // Maps `size` usable bytes between two guard pages and locks them in RAM. Bulk regions are aligned
+    // to the huge page size and backed by huge pages where the system provides them.
+    std::unique_ptr<Region> map_region(const size_t size, const bool bulk) {
+        const size_t page = page_size();
+        const size_t alignment = bulk ? neonfs::SecureHeap::huge_page_size() : page;
+        auto region = std::make_unique<Region>();
+        region->size = size;
+        region->bulk = bulk;
+        region->mapping_size = size + 2 * alignment;
+
+#if defined(_WIN32)
+        if (bulk && map_large_pages(*region)) {
+            region->free.emplace(0, size);
+            return region;
+        }
+        region->mapping_size = size + 2 * page;
+        region->mapping = static_cast<uint8_t*>(VirtualAlloc(nullptr, region->mapping_size, MEM_RESERVE | MEM_COMMIT, PAGE_NOACCESS));
+        if (!region->mapping) return nullptr;
+        region->base = region->mapping + page;
+
+        DWORD previous;
+        if (!VirtualProtect(region->base, size, PAGE_READWRITE, &previous)) {
+            VirtualFree(region->mapping, 0, MEM_RELEASE);
+            return nullptr;
+        }
+        region->locked = VirtualLock(region->base, size) != 0;
+#else
+        // Bulk regions over-reserve by one huge page on each side so an aligned base still has guards
+        void* mapping = mmap(nullptr, region->mapping_size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (mapping == MAP_FAILED) return nullptr;
+        region->mapping = static_cast<uint8_t*>(mapping);
+        region->base = reinterpret_cast<uint8_t*>(round_up(reinterpret_cast<uintptr_t>(region->mapping) + page, alignment));
+
+        const bool mapped = bulk ? map_huge_pages(*region) : mprotect(region->base, size, PROT_READ | PROT_WRITE) == 0;
+        if (!mapped) {
+            munmap(region->mapping, region->mapping_size);
+            return nullptr;
+        }
+        // Like OpenSSL's secure heap, a failed lock (usually RLIMIT_MEMLOCK) leaves the region usable
+        region->locked = mlock(region->base, size) == 0;
+#if defined(MADV_DONTDUMP)
+        madvise(region->base, size, MADV_DONTDUMP);
+#endif
+#endif
+
+        region->free.emplace(0, size);
+        return region;
+    }
+
+    void unmap_region(const Region& region) {
+#if defined(_WIN32)
+        if (region.locked && region.backing != PageBacking::Explicit) VirtualUnlock(region.base, region.size);
+        VirtualFree(region.mapping, 0, MEM_RELEASE);
+#else
+        if (region.locked) munlock(region.base, region.size);
+        munmap(region.mapping, region.mapping_size);
+#endif
+    }
+
+    // Caller holds the exclusive lock
+    Region* add_region(State& shared, const size_t minimum, const bool bulk) {
+        const size_t size = bulk ? round_up(minimum, neonfs::SecureHeap::huge_page_size())
+                                 : round_up(std::max(shared.config.region_size, minimum), page_size());
+        if (shared.mapped.load(std::memory_order_relaxed) + size > shared.config.max_size) return nullptr;
+
+        auto region = map_region(size, bulk);
+        if (!region) return nullptr;
+
+        Region* raw = region.get();
+        const auto position = std::lower_bound(shared.regions.begin(), shared.regions.end(), raw->base,
+                                               [](const std::unique_ptr<Region>& r, const uint8_t* base) { return r->base < base; });
+        shared.regions.insert(position, std::move(region));
+        shared.mapped.fetch_add(size, std::memory_order_relaxed);
+        return raw;
+    }
+
+    // Caller holds the exclusive lock. Keeps up to `keep` empty regions of each kind.
+    size_t remove_empty_regions(State& shared, const size_t keep) {
+        size_t released = 0;
+        size_t kept[2] = {0, 0};
+        for (auto it = shared.regions.begin(); it != shared.regions.end();) {
+            if ((*it)->used != 0) {
+                ++it;
+            } else if (kept[(*it)->bulk] < keep) {
+                ++kept[(*it)->bulk];
+                ++it;
+            } else {
+                released += (*it)->size;
+                unmap_region(**it);
+                it = shared.regions.erase(it);
+            }
+        }
+        shared.mapped.fetch_sub(released, std::memory_order_relaxed);
+        return released;
+    }
+
+    // Caller holds the region list lock in either mode
+    Region* find_region(const State& shared, const void* p) {
+        const auto* address = static_cast<const uint8_t*>(p);
+        const auto it = std::upper_bound(shared.regions.begin(), shared.regions.end(), address,
+                                         [](const uint8_t* a, const std::unique_ptr<Region>& r) { return a < r->base; });
+        if (it == shared.regions.begin()) return nullptr;
+
+        Region* region = std::prev(it)->get();
+        return address < region->base + region->size ? region : nullptr;
+    }
+
+    void* allocate_from(Region& region, const size_t bytes) {
+        std::lock_guard<std::mutex> lock(region.mutex);
+        return region.try_allocate(bytes);
+    }
+
+    // Caller holds the exclusive lock
+    void* allocate_or_grow(State& shared, const size_t bytes, const bool bulk) {
+        for (const auto& region : shared.regions) {
+            if (region->bulk != bulk) continue;
+            if (void* p = allocate_from(*region, bytes)) return p;
+        }
+        Region* region = add_region(shared, bytes, bulk);
+        return region ? allocate_from(*region, bytes) : nullptr;
+    }
+}
+
+void neonfs::SecureHeap::initialize(const SecureHeapConfig &config) {
+    State& shared = state();
+    std::unique_lock<std::shared_mutex> lock(shared.mutex);
+    if (shared.initialized.load(std::memory_order_relaxed)) return;
+
+    if (config.region_size == 0 || config.max_size == 0) {
+        throw std::runtime_error("Secure heap region size and limit must be greater than 0");
+    }
+
+    shared.config = config;
+    shared.config.region_size = std::min(config.region_size, config.max_size);
+    for (size_t i = 0; i < config.initial_regions; ++i) {
+        if (!add_region(shared, 0, false)) {
+            remove_empty_regions(shared, 0);
+            throw std::runtime_error("Failed to map secure heap region");
+        }
+    }
+    shared.initialized.store(true, std::memory_order_release);
+}
+
+bool neonfs::SecureHeap::shutdown() noexcept {
+    State& shared = state();
+    std::unique_lock<std::shared_mutex> lock(shared.mutex);
+    if (shared.used.load(std::memory_order_relaxed) != 0) return false;
+
+    remove_empty_regions(shared, 0);
+    shared.initialized.store(false, std::memory_order_release);
+    return true;
+}
+
+bool neonfs::SecureHeap::initialized() noexcept {
+    return state().initialized.load(std::memory_order_acquire);
+}
+
+void *neonfs::SecureHeap::allocate(const size_t bytes) noexcept {
+    if (bytes == 0) return nullptr;
+    const size_t needed = round_up(bytes, granule);
+    State& shared = state();
+
+    // Threads start where their last allocation succeeded, which spreads them over the regions
+    thread_local size_t hint = 0;
+    bool bulk;
+    {
+        std::shared_lock<std::shared_mutex> lock(shared.mutex);
+        if (!shared.initialized.load(std::memory_order_relaxed)) return nullptr;
+        const size_t threshold = shared.config.huge_page_threshold;
+        bulk = threshold != 0 && needed >= threshold;
+
+        const size_t count = shared.regions.size();
+        for (size_t i = 0; i < count; ++i) {
+            const size_t index = (hint + i) % count;
+            if (shared.regions[index]->bulk != bulk) continue;
+            if (void* p = allocate_from(*shared.regions[index], needed)) {
+                hint = index;
+                shared.used.fetch_add(needed, std::memory_order_relaxed);
+                return p;
+            }
+        }
+    }
+
+    // Every region is full: retry under the exclusive lock in case another thread grew the heap, then grow
+    std::unique_lock<std::shared_mutex> lock(shared.mutex);
+    if (!shared.initialized.load(std::memory_order_relaxed)) return nullptr;
+
+    void* p = allocate_or_grow(shared, needed, bulk);
+    // Rounding to whole huge pages can cross the limit where a regular region would still fit
+    if (!p && bulk) p = allocate_or_grow(shared, needed, false);
+    if (p) shared.used.fetch_add(needed, std::memory_order_relaxed);
+    return p;
+}
+
+void neonfs::SecureHeap::deallocate(void *p, const size_t bytes) noexcept {
+    if (!p || bytes == 0) return;
+    const size_t needed = round_up(bytes, granule);
+    State& shared = state();
+
+    bool emptied = false;
+    {
+        std::shared_lock<std::shared_mutex> lock(shared.mutex);
+        Region* region = find_region(shared, p);
+        if (!region) return;
+
+        std::lock_guard<std::mutex> regionLock(region->mutex);
+        region->release(static_cast<size_t>(static_cast<uint8_t*>(p) - region->base), needed);
+        region->used -= needed;
+        emptied = region->used == 0;
+        shared.used.fetch_sub(needed, std::memory_order_relaxed);
+    }
+
+    if (emptied) {
+        std::unique_lock<std::shared_mutex> lock(shared.mutex);
+        remove_empty_regions(shared, shared.config.idle_regions);
+    }
+}
+
+bool neonfs::SecureHeap::owns(const void *p) noexcept {
+    State& shared = state();
+    std::shared_lock<std::shared_mutex> lock(shared.mutex);
+    return find_region(shared, p) != nullptr;
+}
+
+size_t neonfs::SecureHeap::trim() noexcept {
+    State& shared = state();
+    std::unique_lock<std::shared_mutex> lock(shared.mutex);
+    return remove_empty_regions(shared, 0);
+}
+
+size_t neonfs::SecureHeap::used() noexcept {
+    return state().used.load(std::memory_order_relaxed);
+}
+
+size_t neonfs::SecureHeap::mapped() noexcept {
+    return state().mapped.load(std::memory_order_relaxed);
+}
+
+size_t neonfs::SecureHeap::limit() noexcept {
+    State& shared = state();
+    std::shared_lock<std::shared_mutex> lock(shared.mutex);
+    return shared.initialized.load(std::memory_order_relaxed) ? shared.config.max_size : 0;
+}
+
+size_t neonfs::SecureHeap::region_count() noexcept {
+    State& shared = state();
+    std::shared_lock<std::shared_mutex> lock(shared.mutex);
+    return shared.regions.size();
+}
+
+size_t neonfs::SecureHeap::unlocked_region_count() noexcept {
+    State& shared = state();
+    std::shared_lock<std::shared_mutex> lock(shared.mutex);
+    return static_cast<size_t>(std::count_if(shared.regions.begin(), shared.regions.end(), [](const auto& r) { return !r->locked; }));
+}
+
+size_t neonfs::SecureHeap::huge_region_count() noexcept {
+    State& shared = state();
+    std::shared_lock<std::shared_mutex> lock(shared.mutex);
+    return static_cast<size_t>(std::count_if(shared.regions.begin(), shared.regions.end(),
+                                             [](const auto& r) { return r->backing != PageBacking::Regular; }));
+}
+
+size_t neonfs::SecureHeap::huge_page_size() noexcept {
+    static const size_t size = detect_huge_page_size();
+    return size;
+}
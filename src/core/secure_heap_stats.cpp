@@ -0,0 +1,222 @@
+#include <NeonFS/core/secure_heap_stats.h>
+#include <NeonFS/core/secure_heap.h>
+#include <NeonFS/core/secure_slab_pool.h>
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstring>
+#include <map>
+#include <mutex>
+
+namespace {
+    constexpr size_t tag_slots = 16;
+    constexpr const char* other_tag = "(other)";
+
+    // Written only by its owning thread, so a plain load and store is enough and avoids a locked add
+    struct Counter {
+        std::atomic<uint64_t> value{0};
+
+        void add(const uint64_t n) {
+            value.store(value.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] uint64_t get() const {
+            return value.load(std::memory_order_relaxed);
+        }
+    };
+
+    struct TagSlot {
+        std::atomic<const char*> tag{nullptr};
+        Counter allocations;
+        Counter bytes;
+        Counter failed;
+    };
+
+    struct ThreadStats;
+
+    // Totals of exited threads plus the list of live ones
+    struct Registry {
+        std::mutex mutex;
+        std::vector<ThreadStats*> threads;
+
+        uint64_t allocations = 0;
+        uint64_t deallocations = 0;
+        uint64_t failed = 0;
+        uint64_t bytes_allocated = 0;
+        uint64_t bytes_freed = 0;
+        std::array<uint64_t, neonfs::SecureHeapSnapshot::size_buckets> by_size{};
+        std::map<std::string, neonfs::SecureHeapTagStats> tags;
+
+        std::atomic<size_t> heap_peak{0};
+    };
+
+    // Never destroyed: threads may exit during static destruction
+    Registry& registry() {
+        static auto* instance = new Registry();
+        return *instance;
+    }
+
+    struct ThreadStats {
+        Counter allocations;
+        Counter deallocations;
+        Counter failed;
+        Counter bytes_allocated;
+        Counter bytes_freed;
+        std::array<Counter, neonfs::SecureHeapSnapshot::size_buckets> by_size;
+        std::array<TagSlot, tag_slots> tags;
+        const char* current_tag = nullptr;
+
+        ThreadStats() {
+            Registry& shared = registry();
+            std::lock_guard<std::mutex> lock(shared.mutex);
+            shared.threads.push_back(this);
+        }
+
+        ~ThreadStats() {
+            Registry& shared = registry();
+            std::lock_guard<std::mutex> lock(shared.mutex);
+            add_to(shared.allocations, shared.deallocations, shared.failed, shared.bytes_allocated, shared.bytes_freed, shared.by_size, shared.tags);
+            std::erase(shared.threads, this);
+        }
+
+        void add_to(uint64_t& allocs, uint64_t& deallocs, uint64_t& fails, uint64_t& allocated, uint64_t& freed,
+                    std::array<uint64_t, neonfs::SecureHeapSnapshot::size_buckets>& sizes,
+                    std::map<std::string, neonfs::SecureHeapTagStats>& tagTotals) const {
+            allocs += allocations.get();
+            deallocs += deallocations.get();
+            fails += failed.get();
+            allocated += bytes_allocated.get();
+            freed += bytes_freed.get();
+            for (size_t i = 0; i < sizes.size(); ++i) sizes[i] += by_size[i].get();
+
+            for (const TagSlot& slot : tags) {
+                const char* tag = slot.tag.load(std::memory_order_acquire);
+                if (!tag) break;
+                auto& total = tagTotals[tag];
+                total.tag = tag;
+                total.allocations += slot.allocations.get();
+                total.bytes_allocated += slot.bytes.get();
+                total.failed_allocations += slot.failed.get();
+            }
+        }
+
+        // Slots are claimed in order and never released, so a scan stops at the first empty one
+        TagSlot& tag_slot(const char* tag) {
+            for (size_t i = 0; i < tag_slots - 1; ++i) {
+                const char* claimed = tags[i].tag.load(std::memory_order_relaxed);
+                if (claimed == tag || (claimed && std::strcmp(claimed, tag) == 0)) return tags[i];
+                if (!claimed) {
+                    tags[i].tag.store(tag, std::memory_order_release);
+                    return tags[i];
+                }
+            }
+            TagSlot& overflow = tags[tag_slots - 1];
+            if (!overflow.tag.load(std::memory_order_relaxed)) overflow.tag.store(other_tag, std::memory_order_release);
+            return overflow;
+        }
+    };
+
+    ThreadStats& thread_stats() {
+        thread_local ThreadStats stats;
+        return stats;
+    }
+
+    size_t size_bucket(const size_t bytes) {
+        const size_t bucket = bytes <= 16 ? 0 : std::bit_width(bytes - 1) - 4;
+        return std::min(bucket, neonfs::SecureHeapSnapshot::size_buckets - 1);
+    }
+}
+
+size_t neonfs::SecureHeapSnapshot::bucket_limit(const size_t bucket) {
+    return size_t{16} << bucket;
+}
+
+neonfs::SecureHeapSnapshot neonfs::SecureHeapStats::snapshot() {
+    SecureHeapSnapshot snap;
+    Registry& shared = registry();
+
+    uint64_t bytes_allocated = 0;
+    uint64_t bytes_freed = 0;
+    std::map<std::string, SecureHeapTagStats> tags;
+    {
+        std::lock_guard<std::mutex> lock(shared.mutex);
+        snap.allocations = shared.allocations;
+        snap.deallocations = shared.deallocations;
+        snap.failed_allocations = shared.failed;
+        snap.allocations_by_size = shared.by_size;
+        bytes_allocated = shared.bytes_allocated;
+        bytes_freed = shared.bytes_freed;
+        tags = shared.tags;
+
+        for (const ThreadStats* stats : shared.threads) {
+            stats->add_to(snap.allocations, snap.deallocations, snap.failed_allocations, bytes_allocated, bytes_freed, snap.allocations_by_size, tags);
+        }
+    }
+
+    // Racing with live threads can briefly show more frees than allocations
+    snap.bytes_in_use = bytes_allocated > bytes_freed ? static_cast<size_t>(bytes_allocated - bytes_freed) : 0;
+    for (auto& [name, stats] : tags) snap.tags.push_back(std::move(stats));
+
+    snap.heap_size = SecureHeap::limit();
+    snap.heap_used = SecureHeap::used();
+    snap.heap_mapped = SecureHeap::mapped();
+    snap.regions = SecureHeap::region_count();
+    snap.unlocked_regions = SecureHeap::unlocked_region_count();
+    snap.huge_regions = SecureHeap::huge_region_count();
+    snap.heap_peak = std::max(shared.heap_peak.load(std::memory_order_relaxed), snap.heap_used);
+    snap.slab_reserved = SecureSlabPool::reserved_bytes();
+    if (snap.heap_used > 0) {
+        snap.fragmentation = 1.0 - static_cast<double>(std::min(snap.bytes_in_use, snap.heap_used)) / static_cast<double>(snap.heap_used);
+    }
+    return snap;
+}
+
+void neonfs::SecureHeapStats::reset_peak() noexcept {
+    registry().heap_peak.store(SecureHeap::used(), std::memory_order_relaxed);
+}
+
+uint64_t neonfs::SecureHeapStats::thread_allocations() noexcept {
+    return thread_stats().allocations.get();
+}
+
+void neonfs::SecureHeapStats::record_allocation(const size_t bytes) noexcept {
+    ThreadStats& stats = thread_stats();
+    stats.allocations.add(1);
+    stats.bytes_allocated.add(bytes);
+    stats.by_size[size_bucket(bytes)].add(1);
+
+    if (stats.current_tag) {
+        TagSlot& slot = stats.tag_slot(stats.current_tag);
+        slot.allocations.add(1);
+        slot.bytes.add(bytes);
+    }
+}
+
+void neonfs::SecureHeapStats::record_deallocation(const size_t bytes) noexcept {
+    ThreadStats& stats = thread_stats();
+    stats.deallocations.add(1);
+    stats.bytes_freed.add(bytes);
+}
+
+void neonfs::SecureHeapStats::record_failure() noexcept {
+    ThreadStats& stats = thread_stats();
+    stats.failed.add(1);
+    if (stats.current_tag) {
+        stats.tag_slot(stats.current_tag).failed.add(1);
+    }
+}
+
+void neonfs::SecureHeapStats::record_heap_growth() noexcept {
+    const size_t used = SecureHeap::used();
+    std::atomic<size_t>& peak = registry().heap_peak;
+    size_t current = peak.load(std::memory_order_relaxed);
+    while (used > current && !peak.compare_exchange_weak(current, used, std::memory_order_relaxed)) {}
+}
+
+neonfs::SecureHeapTag::SecureHeapTag(const char *tag) noexcept : previous_(thread_stats().current_tag) {
+    thread_stats().current_tag = tag;
+}
+
+neonfs::SecureHeapTag::~SecureHeapTag() {
+    thread_stats().current_tag = previous_;
+}
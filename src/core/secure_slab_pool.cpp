@@ -0,0 +1,201 @@
+#include <NeonFS/core/secure_slab_pool.h>
+#include <NeonFS/core/secure_heap.h>
+#include <NeonFS/core/secure_heap_stats.h>
+#include <openssl/crypto.h>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace {
+    // 4160 = a 4 KiB block plus EVP_MAX_BLOCK_LENGTH of cipher output slack, rounded to 64 bytes
+    constexpr std::array<size_t, 17> class_sizes = {
+        16, 32, 48, 64, 96, 128, 192, 256, 384, 512, 768, 1024, 1536, 2048, 3072, 4096, 4160
+    };
+    constexpr size_t class_count = class_sizes.size();
+    constexpr size_t granule = 16;
+
+    static_assert(class_sizes.back() == neonfs::SecureSlabPool::max_allocation);
+
+    // Maps (bytes + 15) / 16 to a class index so lookups are a single load
+    constexpr auto class_lookup = [] {
+        std::array<uint8_t, neonfs::SecureSlabPool::max_allocation / granule + 1> lookup{};
+        size_t cls = 0;
+        for (size_t i = 0; i < lookup.size(); ++i) {
+            while (class_sizes[cls] < i * granule) ++cls;
+            lookup[i] = static_cast<uint8_t>(cls);
+        }
+        return lookup;
+    }();
+
+    size_t class_index(const size_t bytes) {
+        return class_lookup[(bytes + granule - 1) / granule];
+    }
+
+    // Slabs hold at least 32 blocks; powers of two keep them page-aligned within a secure heap region
+    constexpr size_t slab_bytes(const size_t cls) {
+        return std::bit_ceil(std::max<size_t>(64 * 1024, class_sizes[cls] * 32));
+    }
+
+    constexpr size_t blocks_per_slab(const size_t cls) {
+        return slab_bytes(cls) / class_sizes[cls];
+    }
+
+    // Bound the memory a thread can park in its cache, per class
+    constexpr uint32_t cache_capacity(const size_t cls) {
+        return class_sizes[cls] <= 256 ? 64 : class_sizes[cls] <= 1024 ? 32 : 16;
+    }
+    constexpr uint32_t max_cache_capacity = 64;
+
+    struct ClassDepot {
+        std::mutex mutex;
+        std::vector<void*> free;
+        std::vector<void*> slabs;
+    };
+
+    struct Depot {
+        std::array<ClassDepot, class_count> classes;
+    };
+
+    // Never destroyed: threads may return their caches during static destruction
+    Depot& depot() {
+        static auto* instance = new Depot();
+        return *instance;
+    }
+
+    struct ThreadCache {
+        struct Bin {
+            std::array<void*, max_cache_capacity> slots{};
+            uint32_t count = 0;
+        };
+        std::array<Bin, class_count> bins{};
+
+        // Moves `count` blocks from the top of a bin back to the depot
+        void drain(const size_t cls, const uint32_t count) {
+            Bin& bin = bins[cls];
+            ClassDepot& shared = depot().classes[cls];
+            std::lock_guard<std::mutex> lock(shared.mutex);
+            shared.free.insert(shared.free.end(), bin.slots.begin() + (bin.count - count), bin.slots.begin() + bin.count);
+            bin.count -= count;
+        }
+
+        void drain_all() {
+            for (size_t cls = 0; cls < class_count; ++cls) {
+                if (bins[cls].count) drain(cls, bins[cls].count);
+            }
+        }
+
+        ~ThreadCache() {
+            drain_all();
+        }
+    };
+
+    ThreadCache& thread_cache() {
+        thread_local ThreadCache cache;
+        return cache;
+    }
+
+    // Refills half a bin from the depot, carving a new slab when the depot is empty
+    bool refill(const size_t cls, ThreadCache::Bin& bin) {
+        ClassDepot& shared = depot().classes[cls];
+        std::lock_guard<std::mutex> lock(shared.mutex);
+
+        if (shared.free.empty()) {
+            auto* slab = static_cast<uint8_t*>(neonfs::SecureHeap::allocate(slab_bytes(cls)));
+            if (!slab) return false;
+            shared.slabs.push_back(slab);
+            neonfs::SecureHeapStats::record_heap_growth();
+
+            const size_t size = class_sizes[cls];
+            const size_t blocks = blocks_per_slab(cls);
+            shared.free.reserve(shared.free.size() + blocks);
+            // Push in reverse so blocks are handed out in address order
+            for (size_t i = blocks; i-- > 0;) {
+                shared.free.push_back(slab + i * size);
+            }
+        }
+
+        const uint32_t take = std::min<uint32_t>(cache_capacity(cls) / 2, static_cast<uint32_t>(shared.free.size()));
+        std::copy(shared.free.end() - take, shared.free.end(), bin.slots.begin() + bin.count);
+        shared.free.resize(shared.free.size() - take);
+        bin.count += take;
+        return true;
+    }
+}
+
+size_t neonfs::SecureSlabPool::size_class(const size_t bytes) noexcept {
+    if (!serves(bytes)) return 0;
+    return class_sizes[class_index(bytes)];
+}
+
+void* neonfs::SecureSlabPool::allocate(const size_t bytes) noexcept {
+    const size_t cls = class_index(bytes);
+    ThreadCache::Bin& bin = thread_cache().bins[cls];
+    if (bin.count == 0 && !refill(cls, bin)) {
+        return nullptr;
+    }
+    return bin.slots[--bin.count];
+}
+
+void neonfs::SecureSlabPool::deallocate(void *p, const size_t bytes) noexcept {
+    // Only the requested bytes can have been written; the rest of the block is still zero
+    OPENSSL_cleanse(p, bytes);
+
+    const size_t cls = class_index(bytes);
+    ThreadCache& cache = thread_cache();
+    ThreadCache::Bin& bin = cache.bins[cls];
+    if (bin.count == cache_capacity(cls)) {
+        cache.drain(cls, bin.count / 2);
+    }
+    bin.slots[bin.count++] = p;
+}
+
+void neonfs::SecureSlabPool::flush_thread_cache() noexcept {
+    thread_cache().drain_all();
+}
+
+bool neonfs::SecureSlabPool::release() noexcept {
+    flush_thread_cache();
+
+    Depot& shared = depot();
+    std::array<std::unique_lock<std::mutex>, class_count> locks;
+    for (size_t cls = 0; cls < class_count; ++cls) {
+        locks[cls] = std::unique_lock<std::mutex>(shared.classes[cls].mutex);
+        const ClassDepot& entry = shared.classes[cls];
+        if (entry.free.size() != entry.slabs.size() * blocks_per_slab(cls)) {
+            return false;
+        }
+    }
+
+    for (size_t cls = 0; cls < class_count; ++cls) {
+        ClassDepot& entry = shared.classes[cls];
+        // Every block was wiped when it was freed
+        for (void* slab : entry.slabs) {
+            SecureHeap::deallocate(slab, slab_bytes(cls));
+        }
+        entry.slabs.clear();
+        entry.free.clear();
+    }
+    return true;
+}
+
+size_t neonfs::SecureSlabPool::slab_count() noexcept {
+    size_t count = 0;
+    for (auto& entry : depot().classes) {
+        std::lock_guard<std::mutex> lock(entry.mutex);
+        count += entry.slabs.size();
+    }
+    return count;
+}
+
+size_t neonfs::SecureSlabPool::reserved_bytes() noexcept {
+    size_t bytes = 0;
+    for (size_t cls = 0; cls < class_count; ++cls) {
+        ClassDepot& entry = depot().classes[cls];
+        std::lock_guard<std::mutex> lock(entry.mutex);
+        bytes += entry.slabs.size() * slab_bytes(cls);
+    }
+    return bytes;
+}
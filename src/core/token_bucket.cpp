@@ -0,0 +1,52 @@
+#include <NeonFS/core/token_bucket.h>
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+
+neonfs::TokenBucket::TokenBucket(const double rate, const double burst)
+    : rate_(rate), burst(burst), tokens(burst), updated(Clock::now()) {
+    if (rate < 0 || burst <= 0) throw std::invalid_argument("Token bucket rate must not be negative and burst must be positive");
+}
+
+void neonfs::TokenBucket::acquire(const double tokens) {
+    std::unique_lock<std::mutex> lock(mutex);
+    if (rate_ == 0) return;
+
+    // Take the tokens now, going into debt if needed, and sleep off the debt outside the lock.
+    // Later callers see the debt and queue behind this one.
+    refill(Clock::now());
+    this->tokens -= tokens;
+    if (this->tokens >= 0) return;
+
+    const auto wait = std::chrono::duration<double>(-this->tokens / rate_);
+    lock.unlock();
+    std::this_thread::sleep_for(wait);
+}
+
+bool neonfs::TokenBucket::try_acquire(const double tokens) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (rate_ == 0) return true;
+
+    refill(Clock::now());
+    if (this->tokens < tokens) return false;
+    this->tokens -= tokens;
+    return true;
+}
+
+void neonfs::TokenBucket::set_rate(const double rate) {
+    if (rate < 0) throw std::invalid_argument("Token bucket rate must not be negative");
+    std::lock_guard<std::mutex> lock(mutex);
+    refill(Clock::now());
+    if (rate_ == 0) tokens = burst;
+    rate_ = rate;
+}
+
+double neonfs::TokenBucket::rate() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return rate_;
+}
+
+void neonfs::TokenBucket::refill(const Clock::time_point now) {
+    tokens = std::min(burst, tokens + std::chrono::duration<double>(now - updated).count() * rate_);
+    updated = now;
+}
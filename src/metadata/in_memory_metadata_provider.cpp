@@ -0,0 +1,137 @@
+#include <NeonFS/metadata/in_memory_metadata_provider.h>
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
+
+namespace {
+    uint64_t now_seconds() {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::seconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count());
+    }
+}
+
+void neonfs::metadata::InMemoryMetadataProvider::initialize() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (records.contains(0)) return;
+
+    Metadata root{};
+    root.fileId = 0;
+    root.filename = "/";
+    root.isDirectory = true;
+    root.permissions = 0755;
+    root.timestamp_created = root.timestamp_modified = now_seconds();
+    records.emplace(0, std::move(root));
+}
+
+void neonfs::metadata::InMemoryMetadataProvider::shutdown() {
+    std::lock_guard<std::mutex> lock(mutex);
+    records.clear();
+    nextId = 1;
+}
+
+void neonfs::metadata::InMemoryMetadataProvider::upsertMetadata(const Metadata &meta) {
+    std::lock_guard<std::mutex> lock(mutex);
+    records[meta.fileId] = meta;
+    nextId = std::max(nextId, meta.fileId + 1);
+}
+
+neonfs::Metadata neonfs::metadata::InMemoryMetadataProvider::getMetadata(const uint64_t fileId) {
+    std::lock_guard<std::mutex> lock(mutex);
+    return records.at(fileId);
+}
+
+void neonfs::metadata::InMemoryMetadataProvider::deleteMetadata(const uint64_t fileId) {
+    std::lock_guard<std::mutex> lock(mutex);
+    records.erase(fileId);
+}
+
+std::vector<uint64_t> neonfs::metadata::InMemoryMetadataProvider::listMetadataIds() {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::vector<uint64_t> ids;
+    ids.reserve(records.size());
+    for (const auto& [id, meta] : records) ids.push_back(id);
+    return ids;
+}
+
+bool neonfs::metadata::InMemoryMetadataProvider::verifyMetadata(const Metadata &meta) {
+    if (meta.isDirectory) return meta.blocks.empty();
+
+    // Blocks must be in file order and lie within the file
+    uint64_t previous = 0;
+    for (size_t i = 0; i < meta.blocks.size(); ++i) {
+        const uint64_t offset = meta.blocks[i].offset;
+        if ((i > 0 && offset <= previous) || offset >= std::max<uint64_t>(meta.size, 1)) return false;
+        previous = offset;
+    }
+    return true;
+}
+
+std::vector<neonfs::Metadata> neonfs::metadata::InMemoryMetadataProvider::batchGetMetadata(const std::vector<uint64_t> &ids) {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::vector<Metadata> result;
+    result.reserve(ids.size());
+    for (const uint64_t id : ids) {
+        if (const auto it = records.find(id); it != records.end()) result.push_back(it->second);
+    }
+    return result;
+}
+
+std::vector<neonfs::Metadata> neonfs::metadata::InMemoryMetadataProvider::getChildren(const uint64_t parentId) {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::vector<Metadata> children;
+    for (const auto& [id, meta] : records) {
+        if (id != 0 && meta.parentId == parentId) children.push_back(meta);
+    }
+    return children;
+}
+
+bool neonfs::metadata::InMemoryMetadataProvider::isDirectoryEmpty(const uint64_t directoryId) {
+    std::lock_guard<std::mutex> lock(mutex);
+    return std::none_of(records.begin(), records.end(), [directoryId](const auto& record) {
+        return record.first != 0 && record.second.parentId == directoryId;
+    });
+}
+
+void neonfs::metadata::InMemoryMetadataProvider::move(const uint64_t fileId, const uint64_t newParentId) {
+    std::lock_guard<std::mutex> lock(mutex);
+    const auto parent = records.find(newParentId);
+    if (parent == records.end() || !parent->second.isDirectory) {
+        throw std::invalid_argument("Target is not a directory");
+    }
+    Metadata& meta = records.at(fileId);
+    meta.parentId = newParentId;
+    meta.timestamp_modified = now_seconds();
+}
+
+uint64_t neonfs::metadata::InMemoryMetadataProvider::createDirectory(const std::string &name, const uint64_t parentId, const uint32_t permissions) {
+    return create(name, parentId, permissions, true);
+}
+
+uint64_t neonfs::metadata::InMemoryMetadataProvider::createFile(const std::string &name, const uint64_t parentId, const uint32_t permissions) {
+    return create(name, parentId, permissions, false);
+}
+
+void neonfs::metadata::InMemoryMetadataProvider::rename(const uint64_t fileId, const std::string &newName) {
+    std::lock_guard<std::mutex> lock(mutex);
+    Metadata& meta = records.at(fileId);
+    meta.filename = newName;
+    meta.timestamp_modified = now_seconds();
+}
+
+uint64_t neonfs::metadata::InMemoryMetadataProvider::create(const std::string &name, const uint64_t parentId, const uint32_t permissions, const bool isDirectory) {
+    std::lock_guard<std::mutex> lock(mutex);
+    const auto parent = records.find(parentId);
+    if (parent == records.end() || !parent->second.isDirectory) {
+        throw std::invalid_argument("Parent is not a directory");
+    }
+
+    Metadata meta{};
+    meta.fileId = nextId++;
+    meta.filename = name;
+    meta.permissions = permissions;
+    meta.isDirectory = isDirectory;
+    meta.parentId = parentId;
+    meta.timestamp_created = meta.timestamp_modified = now_seconds();
+    records.emplace(meta.fileId, meta);
+    return meta.fileId;
+}
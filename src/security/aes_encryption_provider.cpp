@@ -6,27 +6,39 @@ neonfs::security::AESEncryptionProvider::AESEncryptionProvider(secure_bytes &&ma
     if (key_.size() != 32) throw std::invalid_argument("Key must be 256 bits (32 bytes).");
 }
 
+neonfs::security::AESEncryptionProvider::AESEncryptionProvider(secure_bytes &&master_key, const size_t poolMaxSize, std::shared_ptr<IVSequence> ivSequence)
+    : AESEncryptionProvider(std::move(master_key), poolMaxSize) {
+    ivSequence_ = std::move(ivSequence);
+}
+
 neonfs::Result<neonfs::secure_bytes> neonfs::security::AESEncryptionProvider::encrypt(const secure_bytes &plain, secure_bytes &outIV, secure_bytes &outTag) {
     // Validate key first (most critical check)
     if (key_.size() != 32) {
-        return Result<secure_bytes>::err(
-            "Invalid key size: expected 32 bytes, got " +
-            std::to_string(key_.size()));
+        return Result<secure_bytes>::err(ErrorKind::InvalidArgument, "Invalid key size: expected 32 bytes");
     }
 
-    // Auto-generate IV if empty
+    // Auto-generate IV if empty, from the counter when one is configured
     if (outIV.empty()) {
         outIV.resize(iv_size());
-        if (RAND_bytes(outIV.data(), outIV.size()) != 1) {
-            return Result<secure_bytes>::err("Failed to generate secure IV");
+        if (ivSequence_) {
+            auto counter = ivSequence_->next();
+            if (counter.is_err()) {
+                return Result<secure_bytes>::err(counter.unwrap_err());
+            }
+            ivSequence_->make_iv(counter.unwrap(), outIV.data());
+        }
+        else if (RAND_bytes(outIV.data(), outIV.size()) != 1) {
+            return Result<secure_bytes>::err(ErrorKind::Crypto, "Failed to generate secure IV");
         }
     }
     else if (outIV.size() != iv_size()) {
-        return Result<secure_bytes>::err(
-            "Invalid IV size: expected " + std::to_string(iv_size()) +
-            " bytes, got " + std::to_string(outIV.size()));
+        return Result<secure_bytes>::err(ErrorKind::InvalidArgument, "Invalid IV size: expected 12 bytes");
     }
 
+    return encrypt_with_iv(plain, outIV.data(), outTag);
+}
+
+neonfs::Result<neonfs::secure_bytes> neonfs::security::AESEncryptionProvider::encrypt_with_iv(const secure_bytes &plain, const uint8_t *iv, secure_bytes &outTag) {
     // Prepare tag buffer (always overwrite)
     outTag.resize(tag_size());
     std::fill(outTag.begin(), outTag.end(), 0); // Clear any existing data
@@ -35,17 +47,17 @@ neonfs::Result<neonfs::secure_bytes> neonfs::security::AESEncryptionProvider::en
 
     // Initialize the encryption operation
     if (1 != EVP_EncryptInit_ex(ctx_handle->get(), EVP_aes_256_gcm(), nullptr, nullptr, nullptr)) {
-        return Result<secure_bytes>::err("Failed to initialize AES-GCM encryption.");
+        return Result<secure_bytes>::err(ErrorKind::Crypto, "Failed to initialize AES-GCM encryption.");
     }
 
     // Set the IV length
-    if (1 != EVP_CIPHER_CTX_ctrl(ctx_handle->get(), EVP_CTRL_GCM_SET_IVLEN, static_cast<int>(outIV.size()), nullptr)) {
-        return Result<secure_bytes>::err("Failed to set IV length.");
+    if (1 != EVP_CIPHER_CTX_ctrl(ctx_handle->get(), EVP_CTRL_GCM_SET_IVLEN, static_cast<int>(iv_size()), nullptr)) {
+        return Result<secure_bytes>::err(ErrorKind::Crypto, "Failed to set IV length.");
     }
 
     // Initialize key and IV
-    if (1 != EVP_EncryptInit_ex(ctx_handle->get(), nullptr, nullptr, key_.data(), outIV.data())) {
-        return Result<secure_bytes>::err("Failed to set key and IV.");
+    if (1 != EVP_EncryptInit_ex(ctx_handle->get(), nullptr, nullptr, key_.data(), iv)) {
+        return Result<secure_bytes>::err(ErrorKind::Crypto, "Failed to set key and IV.");
     }
 
     // Encrypt the data
@@ -55,24 +67,24 @@ neonfs::Result<neonfs::secure_bytes> neonfs::security::AESEncryptionProvider::en
 
     // Encrypt the plaintext
     if (1 != EVP_EncryptUpdate(ctx_handle->get(), ciphertext.data(), &len, plain.data(), static_cast<int>(plain.size()))) {
-        return Result<secure_bytes>::err("Encryption failed during EVP_EncryptUpdate.");
+        return Result<secure_bytes>::err(ErrorKind::Crypto, "Encryption failed during EVP_EncryptUpdate.");
     }
     ciphertext_len = len;
 
     // Finalize encryption
     if (1 != EVP_EncryptFinal_ex(ctx_handle->get(), ciphertext.data() + len, &len)) {
-        return Result<secure_bytes>::err("Encryption failed during EVP_EncryptFinal_ex.");
+        return Result<secure_bytes>::err(ErrorKind::Crypto, "Encryption failed during EVP_EncryptFinal_ex.");
     }
     ciphertext_len += len;
 
     // Verify ciphertext size matches plaintext size
     if (ciphertext_len != static_cast<int>(plain.size())) {
-        return Result<secure_bytes>::err("Ciphertext size does not match plaintext size.");
+        return Result<secure_bytes>::err(ErrorKind::Crypto, "Ciphertext size does not match plaintext size.");
     }
 
     // Get the authentication tag
     if (1 != EVP_CIPHER_CTX_ctrl(ctx_handle->get(), EVP_CTRL_GCM_GET_TAG, static_cast<int>(outTag.size()), outTag.data())) {
-        return Result<secure_bytes>::err("Failed to retrieve authentication tag.");
+        return Result<secure_bytes>::err(ErrorKind::Crypto, "Failed to retrieve authentication tag.");
     }
 
     // Resize the ciphertext to the actual size
@@ -84,25 +96,19 @@ neonfs::Result<neonfs::secure_bytes> neonfs::security::AESEncryptionProvider::en
 neonfs::Result<neonfs::secure_bytes> neonfs::security::AESEncryptionProvider::decrypt(const secure_bytes &cipher, const secure_bytes &iv, secure_bytes &tag) {
     // Validate all inputs before processing
     if (key_.size() != 32) {
-        return Result<secure_bytes>::err(
-            "Invalid key size: expected 32 bytes, got " +
-            std::to_string(key_.size()));
+        return Result<secure_bytes>::err(ErrorKind::InvalidArgument, "Invalid key size: expected 32 bytes");
     }
     if (iv.empty() || iv.size() != iv_size()) {
-        return Result<secure_bytes>::err(
-            "Invalid IV: must be exactly " + std::to_string(iv_size()) +
-            " bytes");
+        return Result<secure_bytes>::err(ErrorKind::InvalidArgument, "Invalid IV: must be exactly 12 bytes");
     }
     if (tag.empty() || tag.size() != tag_size()) {
-        return Result<secure_bytes>::err(
-            "Invalid tag: must be exactly " + std::to_string(tag_size()) +
-            " bytes");
+        return Result<secure_bytes>::err(ErrorKind::InvalidArgument, "Invalid tag: must be exactly 16 bytes");
     }
 
-    if (cipher.empty()) {
-        return Result<secure_bytes>::err("Ciphertext cannot be empty");
-    }
+    return decrypt_with_iv(cipher, iv.data(), tag);
+}
 
+neonfs::Result<neonfs::secure_bytes> neonfs::security::AESEncryptionProvider::decrypt_with_iv(const secure_bytes &cipher, const uint8_t *iv, const secure_bytes &tag) {
     const AESGCMCtxPool::Handle ctx_handle = contextPool_->acquire();
 
     secure_bytes plaintext(cipher.size());
@@ -110,28 +116,28 @@ neonfs::Result<neonfs::secure_bytes> neonfs::security::AESEncryptionProvider::de
 
     // Initialize decryption
     if (1 != EVP_DecryptInit_ex(ctx_handle->get(), EVP_aes_256_gcm(), nullptr, nullptr, nullptr)) {
-        return Result<secure_bytes>::err("Failed to initialize AES-GCM decryption.");
+        return Result<secure_bytes>::err(ErrorKind::Crypto, "Failed to initialize AES-GCM decryption.");
     }
 
     // Set IV length
-    if (1 != EVP_CIPHER_CTX_ctrl(ctx_handle->get(), EVP_CTRL_GCM_SET_IVLEN, static_cast<int>(iv.size()), nullptr)) {
-        return Result<secure_bytes>::err("Failed to set IV length.");
+    if (1 != EVP_CIPHER_CTX_ctrl(ctx_handle->get(), EVP_CTRL_GCM_SET_IVLEN, static_cast<int>(iv_size()), nullptr)) {
+        return Result<secure_bytes>::err(ErrorKind::Crypto, "Failed to set IV length.");
     }
 
     // Set key and IV
-    if (1 != EVP_DecryptInit_ex(ctx_handle->get(), nullptr, nullptr, key_.data(), iv.data())) {
-        return Result<secure_bytes>::err("Failed to set key/IV.");
+    if (1 != EVP_DecryptInit_ex(ctx_handle->get(), nullptr, nullptr, key_.data(), iv)) {
+        return Result<secure_bytes>::err(ErrorKind::Crypto, "Failed to set key/IV.");
     }
 
-    // Decrypt the ciphertext
-    if (1 != EVP_DecryptUpdate(ctx_handle->get(), plaintext.data(), &len, cipher.data(), static_cast<int>(cipher.size()))) {
-        return Result<secure_bytes>::err("Decryption failed during EVP_DecryptUpdate.");
+    // Decrypt the ciphertext (an empty ciphertext still carries a tag that must verify)
+    if (!cipher.empty() && 1 != EVP_DecryptUpdate(ctx_handle->get(), plaintext.data(), &len, cipher.data(), static_cast<int>(cipher.size()))) {
+        return Result<secure_bytes>::err(ErrorKind::Crypto, "Decryption failed during EVP_DecryptUpdate.");
     }
     plaintext_len = len;
 
     // Set the expected authentication tag
-    if (1 != EVP_CIPHER_CTX_ctrl(ctx_handle->get(), EVP_CTRL_GCM_SET_TAG, static_cast<int>(tag.size()), tag.data())) {
-        return Result<secure_bytes>::err("Failed to set authentication tag.");
+    if (1 != EVP_CIPHER_CTX_ctrl(ctx_handle->get(), EVP_CTRL_GCM_SET_TAG, static_cast<int>(tag.size()), const_cast<uint8_t*>(tag.data()))) {
+        return Result<secure_bytes>::err(ErrorKind::Crypto, "Failed to set authentication tag.");
     }
 
     // Finalize decryption and verify the tag
@@ -140,7 +146,7 @@ neonfs::Result<neonfs::secure_bytes> neonfs::security::AESEncryptionProvider::de
 
     // Check if decryption and tag verification were successful
     if (ret <= 0) {
-        return Result<secure_bytes>::err("Decryption failed: Invalid tag or corrupted data.");
+        return Result<secure_bytes>::err(ErrorKind::Authentication, "Decryption failed: Invalid tag or corrupted data.");
     }
 
     // Resize the plaintext to the actual size
@@ -149,6 +155,37 @@ neonfs::Result<neonfs::secure_bytes> neonfs::security::AESEncryptionProvider::de
     return Result<secure_bytes>::ok(plaintext);
 }
 
+neonfs::Result<neonfs::secure_bytes> neonfs::security::AESEncryptionProvider::encrypt_with_generation(const secure_bytes &plain, uint64_t &outGeneration, secure_bytes &outTag) {
+    if (!ivSequence_) {
+        return Result<secure_bytes>::err(ErrorKind::Unsupported, "Provider has no IV sequence configured");
+    }
+
+    auto counter = ivSequence_->next();
+    if (counter.is_err()) {
+        return Result<secure_bytes>::err(counter.unwrap_err());
+    }
+
+    // The IV only lives on the stack; callers store the generation instead
+    uint8_t iv[IVSequence::iv_size];
+    ivSequence_->make_iv(counter.unwrap(), iv);
+
+    auto result = encrypt_with_iv(plain, iv, outTag);
+    if (result.is_ok()) outGeneration = counter.unwrap();
+    return result;
+}
+
+neonfs::Result<neonfs::secure_bytes> neonfs::security::AESEncryptionProvider::decrypt_with_generation(const secure_bytes &cipher, const uint64_t generation, const secure_bytes &tag) {
+    if (!ivSequence_) {
+        return Result<secure_bytes>::err(ErrorKind::Unsupported, "Provider has no IV sequence configured");
+    }
+    if (tag.size() != tag_size()) {
+        return Result<secure_bytes>::err(ErrorKind::InvalidArgument, "Invalid tag: must be exactly 16 bytes");
+    }
+    uint8_t iv[IVSequence::iv_size];
+    ivSequence_->make_iv(generation, iv);
+    return decrypt_with_iv(cipher, iv, tag);
+}
+
 size_t neonfs::security::AESEncryptionProvider::iv_size() const {
     return 12;
 }
@@ -0,0 +1,118 @@
+#include <NeonFS/security/aes_gcm_siv_provider.h>
+#include <openssl/rand.h>
+
+namespace {
+    // Only available from OpenSSL 3.2; older libraries return nullptr
+    EVP_CIPHER* fetch_gcm_siv() {
+        return EVP_CIPHER_fetch(nullptr, "AES-256-GCM-SIV", nullptr);
+    }
+}
+
+neonfs::security::AESGCMSIVProvider::AESGCMSIVProvider(secure_bytes &&key, const size_t poolMaxSize): contextPool_(AESGCMCtxPool::create(poolMaxSize)), key_(std::move(key)) {
+    if (key_.size() != 32) throw std::invalid_argument("Key must be 256 bits (32 bytes).");
+    cipher_ = fetch_gcm_siv();
+    if (!cipher_) throw std::runtime_error("AES-256-GCM-SIV is not available in this OpenSSL build (requires 3.2+).");
+}
+
+neonfs::security::AESGCMSIVProvider::~AESGCMSIVProvider() {
+    EVP_CIPHER_free(cipher_);
+}
+
+bool neonfs::security::AESGCMSIVProvider::is_available() {
+    EVP_CIPHER* cipher = fetch_gcm_siv();
+    EVP_CIPHER_free(cipher);
+    return cipher != nullptr;
+}
+
+neonfs::Result<neonfs::secure_bytes> neonfs::security::AESGCMSIVProvider::encrypt(const secure_bytes &plain, secure_bytes &outIV, secure_bytes &outTag) {
+    if (outIV.empty()) {
+        outIV.resize(iv_size());
+        if (RAND_bytes(outIV.data(), static_cast<int>(outIV.size())) != 1) {
+            return Result<secure_bytes>::err(ErrorKind::Crypto, "Failed to generate secure IV");
+        }
+    }
+    else if (outIV.size() != iv_size()) {
+        return Result<secure_bytes>::err(ErrorKind::InvalidArgument, "Invalid IV size: expected 12 bytes");
+    }
+
+    outTag.resize(tag_size());
+    std::fill(outTag.begin(), outTag.end(), 0);
+
+    const AESGCMCtxPool::Handle ctx_handle = contextPool_->acquire();
+
+    if (1 != EVP_EncryptInit_ex2(ctx_handle->get(), cipher_, key_.data(), outIV.data(), nullptr)) {
+        return Result<secure_bytes>::err(ErrorKind::Crypto, "Failed to initialize AES-GCM-SIV encryption.");
+    }
+
+    // SIV needs the whole message in a single update; the dummy byte keeps the output pointer non-null
+    secure_bytes ciphertext(plain.size() + 1);
+    int len = 0;
+    int ciphertext_len = 0;
+
+    if (1 != EVP_EncryptUpdate(ctx_handle->get(), ciphertext.data(), &len, plain.data(), static_cast<int>(plain.size()))) {
+        return Result<secure_bytes>::err(ErrorKind::Crypto, "Encryption failed during EVP_EncryptUpdate.");
+    }
+    ciphertext_len = len;
+
+    if (1 != EVP_EncryptFinal_ex(ctx_handle->get(), ciphertext.data() + ciphertext_len, &len)) {
+        return Result<secure_bytes>::err(ErrorKind::Crypto, "Encryption failed during EVP_EncryptFinal_ex.");
+    }
+    ciphertext_len += len;
+
+    if (ciphertext_len != static_cast<int>(plain.size())) {
+        return Result<secure_bytes>::err(ErrorKind::Crypto, "Ciphertext size does not match plaintext size.");
+    }
+
+    if (1 != EVP_CIPHER_CTX_ctrl(ctx_handle->get(), EVP_CTRL_AEAD_GET_TAG, static_cast<int>(outTag.size()), outTag.data())) {
+        return Result<secure_bytes>::err(ErrorKind::Crypto, "Failed to retrieve authentication tag.");
+    }
+
+    ciphertext.resize(ciphertext_len);
+    return Result<secure_bytes>::ok(std::move(ciphertext));
+}
+
+neonfs::Result<neonfs::secure_bytes> neonfs::security::AESGCMSIVProvider::decrypt(const secure_bytes &cipher, const secure_bytes &iv, secure_bytes &tag) {
+    if (iv.size() != iv_size()) {
+        return Result<secure_bytes>::err(ErrorKind::InvalidArgument, "Invalid IV: must be exactly 12 bytes");
+    }
+    if (tag.size() != tag_size()) {
+        return Result<secure_bytes>::err(ErrorKind::InvalidArgument, "Invalid tag: must be exactly 16 bytes");
+    }
+
+    const AESGCMCtxPool::Handle ctx_handle = contextPool_->acquire();
+
+    if (1 != EVP_DecryptInit_ex2(ctx_handle->get(), cipher_, key_.data(), iv.data(), nullptr)) {
+        return Result<secure_bytes>::err(ErrorKind::Crypto, "Failed to initialize AES-GCM-SIV decryption.");
+    }
+
+    // SIV derives the keystream from the tag, so it must be known before decrypting
+    if (1 != EVP_CIPHER_CTX_ctrl(ctx_handle->get(), EVP_CTRL_AEAD_SET_TAG, static_cast<int>(tag.size()), tag.data())) {
+        return Result<secure_bytes>::err(ErrorKind::Crypto, "Failed to set authentication tag.");
+    }
+
+    secure_bytes plaintext(cipher.size() + 1);
+    int len = 0, plaintext_len = 0;
+
+    if (1 != EVP_DecryptUpdate(ctx_handle->get(), plaintext.data(), &len, cipher.data(), static_cast<int>(cipher.size()))) {
+        return Result<secure_bytes>::err(ErrorKind::Authentication, "Decryption failed: Invalid tag or corrupted data.");
+    }
+    plaintext_len = len;
+
+    const int ret = EVP_DecryptFinal_ex(ctx_handle->get(), plaintext.data() + plaintext_len, &len);
+    plaintext_len += len;
+
+    if (ret <= 0) {
+        return Result<secure_bytes>::err(ErrorKind::Authentication, "Decryption failed: Invalid tag or corrupted data.");
+    }
+
+    plaintext.resize(plaintext_len);
+    return Result<secure_bytes>::ok(std::move(plaintext));
+}
+
+size_t neonfs::security::AESGCMSIVProvider::iv_size() const {
+    return 12;
+}
+
+size_t neonfs::security::AESGCMSIVProvider::tag_size() const {
+    return 16;
+}
@@ -0,0 +1,76 @@
+#include <NeonFS/security/block_crypto.h>
+#include <NeonFS/security/aes_encryption_provider.h>
+#include <algorithm>
+#include <vector>
+
+uint64_t neonfs::security::chunk_size(const Metadata &meta, const uint64_t blockSize) {
+    return blockSize * std::max<uint32_t>(meta.chunkBlocks, 1);
+}
+
+size_t neonfs::security::block_cipher_length(const Metadata &meta, const BlockInfo &block, const uint64_t blockSize) {
+    if (block.offset >= meta.size) return 0;
+    return static_cast<size_t>(std::min<uint64_t>(chunk_size(meta, blockSize), meta.size - block.offset));
+}
+
+uint32_t neonfs::security::storage_blocks_for(const size_t cipherLength, const uint64_t blockSize) {
+    return static_cast<uint32_t>(std::max<uint64_t>((cipherLength + blockSize - 1) / blockSize, 1));
+}
+
+neonfs::Result<neonfs::secure_bytes> neonfs::security::read_block_cipher(IStorageProvider &storage, const Metadata &meta, const BlockInfo &block) {
+    const uint64_t blockSize = storage.getBlockSize();
+    const size_t length = block_cipher_length(meta, block, blockSize);
+    if (block.blockCount == 0) {
+        if (block.inlineData.size() != length) {
+            return Result<secure_bytes>::err(ErrorKind::InvalidArgument, "Inline ciphertext length does not match the metadata");
+        }
+        return Result<secure_bytes>::ok(secure_bytes(block.inlineData.begin(), block.inlineData.end()));
+    }
+    if (block.packed) {
+        secure_bytes cipher(length);
+        if (auto read = storage.readBlockRange(block.blockId, block.packedOffset, cipher); read.is_err()) {
+            return Result<secure_bytes>::err(read.unwrap_err());
+        }
+        return Result<secure_bytes>::ok(std::move(cipher));
+    }
+    if (storage_blocks_for(length, blockSize) > block.blockCount) {
+        return Result<secure_bytes>::err(ErrorKind::InvalidArgument, "Block spans fewer storage blocks than its ciphertext");
+    }
+
+    // Storage blocks are read straight into the result, then cut to the ciphertext
+    secure_bytes cipher(static_cast<size_t>(storage_blocks_for(length, blockSize) * blockSize));
+    for (uint64_t i = 0; i * blockSize < length; ++i) {
+        const std::span<uint8_t> slice = std::span<uint8_t>(cipher).subspan(static_cast<size_t>(i * blockSize), static_cast<size_t>(blockSize));
+        if (auto read = storage.readBlockInto(block.blockId + i, slice); read.is_err()) {
+            return Result<secure_bytes>::err(read.unwrap_err());
+        }
+    }
+    cipher.resize(length);
+    return Result<secure_bytes>::ok(std::move(cipher));
+}
+
+neonfs::Result<void> neonfs::security::write_block_cipher(IStorageProvider &storage, const BlockInfo &block, const std::span<const uint8_t> cipher) {
+    if (block.blockCount == 0) return Result<void>::err(ErrorKind::InvalidArgument, "An inline block has no storage");
+    if (block.packed) return storage.writeBlockRange(block.blockId, block.packedOffset, cipher);
+
+    const uint64_t blockSize = storage.getBlockSize();
+    std::vector<uint8_t> bytes;
+    for (uint64_t from = 0, id = block.blockId; from < cipher.size(); from += blockSize, ++id) {
+        const size_t length = static_cast<size_t>(std::min<uint64_t>(blockSize, cipher.size() - from));
+        bytes.assign(cipher.begin() + static_cast<ptrdiff_t>(from), cipher.begin() + static_cast<ptrdiff_t>(from + length));
+        if (auto written = storage.writeBlock(id, bytes); written.is_err()) return written;
+    }
+    return Result<void>::ok();
+}
+
+neonfs::Result<neonfs::secure_bytes> neonfs::security::decrypt_block(IEncryptionProvider &provider, const BlockInfo &block, const secure_bytes &cipher) {
+    secure_bytes tag(block.tag.begin(), block.tag.end());
+    if (!block.iv.empty()) {
+        return provider.decrypt(cipher, secure_bytes(block.iv.begin(), block.iv.end()), tag);
+    }
+    // Blocks written with an IV sequence store only the counter
+    auto* aes = dynamic_cast<AESEncryptionProvider*>(&provider);
+    if (!aes) {
+        return Result<secure_bytes>::err("Block has no IV and its provider has no IV sequence");
+    }
+    return aes->decrypt_with_generation(cipher, block.generation, tag);
+}
@@ -0,0 +1,110 @@
+#include <NeonFS/security/chacha20_poly1305_provider.h>
+#include <openssl/rand.h>
+
+neonfs::security::ChaCha20Poly1305Provider::ChaCha20Poly1305Provider(secure_bytes &&key, const size_t poolMaxSize): contextPool_(AESGCMCtxPool::create(poolMaxSize)), key_(std::move(key)) {
+    if (key_.size() != 32) throw std::invalid_argument("Key must be 256 bits (32 bytes).");
+}
+
+neonfs::Result<neonfs::secure_bytes> neonfs::security::ChaCha20Poly1305Provider::encrypt(const secure_bytes &plain, secure_bytes &outIV, secure_bytes &outTag) {
+    // Auto-generate nonce if empty
+    if (outIV.empty()) {
+        outIV.resize(iv_size());
+        if (RAND_bytes(outIV.data(), static_cast<int>(outIV.size())) != 1) {
+            return Result<secure_bytes>::err(ErrorKind::Crypto, "Failed to generate secure nonce");
+        }
+    }
+    else if (outIV.size() != iv_size()) {
+        return Result<secure_bytes>::err(ErrorKind::InvalidArgument, "Invalid nonce size: expected 12 bytes");
+    }
+
+    outTag.resize(tag_size());
+    std::fill(outTag.begin(), outTag.end(), 0);
+
+    const AESGCMCtxPool::Handle ctx_handle = contextPool_->acquire();
+
+    if (1 != EVP_EncryptInit_ex(ctx_handle->get(), EVP_chacha20_poly1305(), nullptr, nullptr, nullptr)) {
+        return Result<secure_bytes>::err(ErrorKind::Crypto, "Failed to initialize ChaCha20-Poly1305 encryption.");
+    }
+    if (1 != EVP_CIPHER_CTX_ctrl(ctx_handle->get(), EVP_CTRL_AEAD_SET_IVLEN, static_cast<int>(iv_size()), nullptr)) {
+        return Result<secure_bytes>::err(ErrorKind::Crypto, "Failed to set nonce length.");
+    }
+    if (1 != EVP_EncryptInit_ex(ctx_handle->get(), nullptr, nullptr, key_.data(), outIV.data())) {
+        return Result<secure_bytes>::err(ErrorKind::Crypto, "Failed to set key and nonce.");
+    }
+
+    secure_bytes ciphertext(plain.size() + EVP_MAX_BLOCK_LENGTH);
+    int len = 0;
+    int ciphertext_len = 0;
+
+    if (!plain.empty() && 1 != EVP_EncryptUpdate(ctx_handle->get(), ciphertext.data(), &len, plain.data(), static_cast<int>(plain.size()))) {
+        return Result<secure_bytes>::err(ErrorKind::Crypto, "Encryption failed during EVP_EncryptUpdate.");
+    }
+    ciphertext_len = len;
+
+    if (1 != EVP_EncryptFinal_ex(ctx_handle->get(), ciphertext.data() + ciphertext_len, &len)) {
+        return Result<secure_bytes>::err(ErrorKind::Crypto, "Encryption failed during EVP_EncryptFinal_ex.");
+    }
+    ciphertext_len += len;
+
+    if (ciphertext_len != static_cast<int>(plain.size())) {
+        return Result<secure_bytes>::err(ErrorKind::Crypto, "Ciphertext size does not match plaintext size.");
+    }
+
+    if (1 != EVP_CIPHER_CTX_ctrl(ctx_handle->get(), EVP_CTRL_AEAD_GET_TAG, static_cast<int>(outTag.size()), outTag.data())) {
+        return Result<secure_bytes>::err(ErrorKind::Crypto, "Failed to retrieve authentication tag.");
+    }
+
+    ciphertext.resize(ciphertext_len);
+    return Result<secure_bytes>::ok(std::move(ciphertext));
+}
+
+neonfs::Result<neonfs::secure_bytes> neonfs::security::ChaCha20Poly1305Provider::decrypt(const secure_bytes &cipher, const secure_bytes &iv, secure_bytes &tag) {
+    if (iv.size() != iv_size()) {
+        return Result<secure_bytes>::err(ErrorKind::InvalidArgument, "Invalid nonce: must be exactly 12 bytes");
+    }
+    if (tag.size() != tag_size()) {
+        return Result<secure_bytes>::err(ErrorKind::InvalidArgument, "Invalid tag: must be exactly 16 bytes");
+    }
+
+    const AESGCMCtxPool::Handle ctx_handle = contextPool_->acquire();
+
+    secure_bytes plaintext(cipher.size());
+    int len = 0, plaintext_len = 0;
+
+    if (1 != EVP_DecryptInit_ex(ctx_handle->get(), EVP_chacha20_poly1305(), nullptr, nullptr, nullptr)) {
+        return Result<secure_bytes>::err(ErrorKind::Crypto, "Failed to initialize ChaCha20-Poly1305 decryption.");
+    }
+    if (1 != EVP_CIPHER_CTX_ctrl(ctx_handle->get(), EVP_CTRL_AEAD_SET_IVLEN, static_cast<int>(iv_size()), nullptr)) {
+        return Result<secure_bytes>::err(ErrorKind::Crypto, "Failed to set nonce length.");
+    }
+    if (1 != EVP_DecryptInit_ex(ctx_handle->get(), nullptr, nullptr, key_.data(), iv.data())) {
+        return Result<secure_bytes>::err(ErrorKind::Crypto, "Failed to set key/nonce.");
+    }
+
+    if (!cipher.empty() && 1 != EVP_DecryptUpdate(ctx_handle->get(), plaintext.data(), &len, cipher.data(), static_cast<int>(cipher.size()))) {
+        return Result<secure_bytes>::err(ErrorKind::Crypto, "Decryption failed during EVP_DecryptUpdate.");
+    }
+    plaintext_len = len;
+
+    if (1 != EVP_CIPHER_CTX_ctrl(ctx_handle->get(), EVP_CTRL_AEAD_SET_TAG, static_cast<int>(tag.size()), tag.data())) {
+        return Result<secure_bytes>::err(ErrorKind::Crypto, "Failed to set authentication tag.");
+    }
+
+    const int ret = EVP_DecryptFinal_ex(ctx_handle->get(), plaintext.data() + plaintext_len, &len);
+    plaintext_len += len;
+
+    if (ret <= 0) {
+        return Result<secure_bytes>::err(ErrorKind::Authentication, "Decryption failed: Invalid tag or corrupted data.");
+    }
+
+    plaintext.resize(plaintext_len);
+    return Result<secure_bytes>::ok(std::move(plaintext));
+}
+
+size_t neonfs::security::ChaCha20Poly1305Provider::iv_size() const {
+    return 12;
+}
+
+size_t neonfs::security::ChaCha20Poly1305Provider::tag_size() const {
+    return 16;
+}
@@ -0,0 +1,221 @@
+#include <NeonFS/security/data_key_manager.h>
+#include <openssl/evp.h>
+#include <openssl/rand.h>
+#include <stdexcept>
+
+namespace {
+    using CipherCtx = std::unique_ptr<EVP_CIPHER_CTX, decltype(&EVP_CIPHER_CTX_free)>;
+
+    CipherCtx new_wrap_ctx() {
+        CipherCtx ctx(EVP_CIPHER_CTX_new(), EVP_CIPHER_CTX_free);
+        // Required by OpenSSL 1.1 for the wrap modes; harmless on 3.x
+        if (ctx) EVP_CIPHER_CTX_set_flags(ctx.get(), EVP_CIPHER_CTX_FLAG_WRAP_ALLOW);
+        return ctx;
+    }
+}
+
+neonfs::security::DataKeyManager::DataKeyManager(const uint32_t version, secure_bytes &&master_key, const CipherSuite suite,
+                                                 const size_t cache_capacity, const size_t poolMaxSize)
+    : currentVersion(version), suite(suite), cacheCapacity(cache_capacity), poolMaxSize(poolMaxSize) {
+    if (master_key.size() != data_key_size) throw std::invalid_argument("Master key must be 256 bits (32 bytes).");
+    if (cache_capacity == 0) throw std::invalid_argument("Data key cache capacity must be greater than 0");
+    keyring.emplace(version, std::move(master_key));
+}
+
+neonfs::Result<void> neonfs::security::DataKeyManager::add_master_key(const uint32_t version, secure_bytes &&master_key) {
+    if (master_key.size() != data_key_size) {
+        return Result<void>::err("Master key must be 256 bits (32 bytes)");
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!keyring.emplace(version, std::move(master_key)).second) {
+        return Result<void>::err("Master key version " + std::to_string(version) + " already exists");
+    }
+    return Result<void>::ok();
+}
+
+neonfs::Result<void> neonfs::security::DataKeyManager::set_current_version(const uint32_t version) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!keyring.contains(version)) {
+        return Result<void>::err(ErrorKind::NotFound, "Unknown master key version");
+    }
+    currentVersion = version;
+    return Result<void>::ok();
+}
+
+neonfs::Result<void> neonfs::security::DataKeyManager::retire_master_key(const uint32_t version) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (version == currentVersion) {
+        return Result<void>::err("Cannot retire the current master key");
+    }
+    if (keyring.erase(version) == 0) {
+        return Result<void>::err(ErrorKind::NotFound, "Unknown master key version");
+    }
+    return Result<void>::ok();
+}
+
+uint32_t neonfs::security::DataKeyManager::current_version() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return currentVersion;
+}
+
+neonfs::Result<void> neonfs::security::DataKeyManager::assign_data_key(Metadata &meta) {
+    if (!meta.wrappedKey.empty()) {
+        return Result<void>::err("File already has a data key");
+    }
+
+    secure_bytes dataKey(data_key_size);
+    if (RAND_bytes(dataKey.data(), static_cast<int>(dataKey.size())) != 1) {
+        return Result<void>::err("Failed to generate data key");
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto wrapped = wrap_key(keyring.at(currentVersion), dataKey);
+    if (wrapped.is_err()) {
+        return Result<void>::err(wrapped.unwrap_err());
+    }
+    meta.wrappedKey = wrapped.unwrap_move();
+    meta.wrappingKeyVersion = currentVersion;
+    return Result<void>::ok();
+}
+
+neonfs::Result<std::shared_ptr<neonfs::IEncryptionProvider>> neonfs::security::DataKeyManager::provider_for(const Metadata &meta) {
+    using ProviderResult = Result<std::shared_ptr<IEncryptionProvider>>;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (const auto it = cache.find(meta.fileId); it != cache.end() && it->second.wrappedKey == meta.wrappedKey) {
+            lru.splice(lru.begin(), lru, it->second.position);
+            return ProviderResult::ok(it->second.provider);
+        }
+    }
+
+    // Unwrap and build the provider outside the lock; a racing thread may do the same, and the first insert wins
+    auto dataKey = unwrap_for(meta);
+    if (dataKey.is_err()) {
+        return ProviderResult::err(dataKey.unwrap_err());
+    }
+    auto created = EncryptionProviderFactory::create(suite, dataKey.unwrap_move(), poolMaxSize);
+    if (created.is_err()) {
+        return ProviderResult::err(created.unwrap_err());
+    }
+    std::shared_ptr<IEncryptionProvider> provider = std::move(created.unwrap());
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (const auto it = cache.find(meta.fileId); it != cache.end()) {
+        if (it->second.wrappedKey == meta.wrappedKey) {
+            lru.splice(lru.begin(), lru, it->second.position);
+            return ProviderResult::ok(it->second.provider);
+        }
+        lru.erase(it->second.position);
+        cache.erase(it);
+    }
+    if (cache.size() >= cacheCapacity) {
+        cache.erase(lru.back());
+        lru.pop_back();
+    }
+    lru.push_front(meta.fileId);
+    cache.emplace(meta.fileId, CacheEntry{provider, meta.wrappedKey, lru.begin()});
+    return ProviderResult::ok(provider);
+}
+
+neonfs::Result<bool> neonfs::security::DataKeyManager::rewrap(Metadata &meta) {
+    if (meta.wrappedKey.empty()) {
+        return Result<bool>::err("File has no data key");
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (meta.wrappingKeyVersion == currentVersion) {
+        return Result<bool>::ok(false);
+    }
+    const auto old = keyring.find(meta.wrappingKeyVersion);
+    if (old == keyring.end()) {
+        return Result<bool>::err(ErrorKind::NotFound, "Unknown master key version");
+    }
+
+    auto dataKey = unwrap_key(old->second, meta.wrappedKey);
+    if (dataKey.is_err()) {
+        return Result<bool>::err(dataKey.unwrap_err());
+    }
+    auto wrapped = wrap_key(keyring.at(currentVersion), dataKey.unwrap());
+    if (wrapped.is_err()) {
+        return Result<bool>::err(wrapped.unwrap_err());
+    }
+
+    // The data key is unchanged, so a cached provider stays valid under the new blob
+    if (const auto it = cache.find(meta.fileId); it != cache.end() && it->second.wrappedKey == meta.wrappedKey) {
+        it->second.wrappedKey = wrapped.unwrap();
+    }
+    meta.wrappedKey = wrapped.unwrap_move();
+    meta.wrappingKeyVersion = currentVersion;
+    return Result<bool>::ok(true);
+}
+
+void neonfs::security::DataKeyManager::evict(const uint64_t fileId) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (const auto it = cache.find(fileId); it != cache.end()) {
+        lru.erase(it->second.position);
+        cache.erase(it);
+    }
+}
+
+void neonfs::security::DataKeyManager::clear_cache() {
+    std::lock_guard<std::mutex> lock(mutex);
+    cache.clear();
+    lru.clear();
+}
+
+size_t neonfs::security::DataKeyManager::cached_count() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return cache.size();
+}
+
+neonfs::Result<std::vector<uint8_t>> neonfs::security::DataKeyManager::wrap_key(const secure_bytes &kek, const secure_bytes &key) {
+    if (kek.size() != 32 || key.size() < 16 || key.size() % 8 != 0) {
+        return Result<std::vector<uint8_t>>::err("Invalid key size for AES-256-KW");
+    }
+
+    const CipherCtx ctx = new_wrap_ctx();
+    std::vector<uint8_t> wrapped(key.size() + 8);
+    int len = 0;
+    int final_len = 0;
+    if (!ctx ||
+        EVP_EncryptInit_ex(ctx.get(), EVP_aes_256_wrap(), nullptr, kek.data(), nullptr) != 1 ||
+        EVP_EncryptUpdate(ctx.get(), wrapped.data(), &len, key.data(), static_cast<int>(key.size())) != 1 ||
+        EVP_EncryptFinal_ex(ctx.get(), wrapped.data() + len, &final_len) != 1) {
+        return Result<std::vector<uint8_t>>::err("Key wrapping failed (AES-256-KW)");
+    }
+    wrapped.resize(static_cast<size_t>(len + final_len));
+    return Result<std::vector<uint8_t>>::ok(std::move(wrapped));
+}
+
+neonfs::Result<neonfs::secure_bytes> neonfs::security::DataKeyManager::unwrap_key(const secure_bytes &kek, const std::vector<uint8_t> &wrapped) {
+    if (kek.size() != 32 || wrapped.size() < 24 || wrapped.size() % 8 != 0) {
+        return Result<secure_bytes>::err("Invalid key size for AES-256-KW");
+    }
+
+    const CipherCtx ctx = new_wrap_ctx();
+    secure_bytes key(wrapped.size());
+    int len = 0;
+    int final_len = 0;
+    // The integrity check value is verified in DecryptUpdate, so a wrong master key or a corrupted blob fails here
+    if (!ctx ||
+        EVP_DecryptInit_ex(ctx.get(), EVP_aes_256_wrap(), nullptr, kek.data(), nullptr) != 1 ||
+        EVP_DecryptUpdate(ctx.get(), key.data(), &len, wrapped.data(), static_cast<int>(wrapped.size())) != 1 ||
+        EVP_DecryptFinal_ex(ctx.get(), key.data() + len, &final_len) != 1) {
+        return Result<secure_bytes>::err("Key unwrapping failed: wrong master key or corrupted wrapped key");
+    }
+    key.resize(static_cast<size_t>(len + final_len));
+    return Result<secure_bytes>::ok(std::move(key));
+}
+
+neonfs::Result<neonfs::secure_bytes> neonfs::security::DataKeyManager::unwrap_for(const Metadata &meta) {
+    if (meta.wrappedKey.empty()) {
+        return Result<secure_bytes>::err("File has no data key");
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    const auto kek = keyring.find(meta.wrappingKeyVersion);
+    if (kek == keyring.end()) {
+        return Result<secure_bytes>::err(ErrorKind::NotFound, "Unknown master key version");
+    }
+    return unwrap_key(kek->second, meta.wrappedKey);
+}
@@ -0,0 +1,150 @@
+#include <NeonFS/security/encryption_provider_factory.h>
+#include <NeonFS/security/aes_encryption_provider.h>
+#include <NeonFS/security/aes_gcm_siv_provider.h>
+#include <NeonFS/security/chacha20_poly1305_provider.h>
+#include <openssl/rand.h>
+#include <chrono>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#elif defined(_WIN32) && defined(_M_ARM64)
+#include <windows.h>
+#elif defined(__linux__) && defined(__aarch64__)
+#include <sys/auxv.h>
+#include <asm/hwcap.h>
+#endif
+
+std::optional<bool> neonfs::security::EncryptionProviderFactory::has_hardware_aes() {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    int info[4] = {};
+    __cpuid(info, 1);
+    return (info[2] & (1 << 25)) != 0; // ECX.AESNI
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    return __builtin_cpu_supports("aes") != 0;
+#elif defined(_WIN32) && defined(_M_ARM64)
+    return IsProcessorFeaturePresent(PF_ARM_V8_CRYPTO_INSTRUCTIONS_AVAILABLE) != 0;
+#elif defined(__linux__) && defined(__aarch64__)
+    return (getauxval(AT_HWCAP) & HWCAP_AES) != 0;
+#elif defined(__APPLE__) && defined(__aarch64__)
+    return true; // Every Apple Silicon core implements the ARMv8 crypto extensions
+#else
+    return std::nullopt;
+#endif
+}
+
+bool neonfs::security::EncryptionProviderFactory::is_supported(const CipherSuite suite) {
+    switch (suite) {
+        case CipherSuite::AES_256_GCM:
+        case CipherSuite::CHACHA20_POLY1305:
+            return true;
+        case CipherSuite::AES_256_GCM_SIV:
+            return AESGCMSIVProvider::is_available();
+    }
+    return false;
+}
+
+neonfs::Result<double> neonfs::security::EncryptionProviderFactory::measure_throughput(const CipherSuite suite, const size_t sample_size, const unsigned duration_ms) {
+    if (sample_size == 0 || duration_ms == 0) {
+        return Result<double>::err("Sample size and duration must be greater than 0");
+    }
+
+    secure_bytes key(32);
+    if (RAND_bytes(key.data(), static_cast<int>(key.size())) != 1) {
+        return Result<double>::err("Failed to generate benchmark key");
+    }
+
+    auto provider = create(suite, std::move(key), 1);
+    if (provider.is_err()) {
+        return Result<double>::err(provider.unwrap_err());
+    }
+
+    const secure_bytes sample(sample_size, 0xA5);
+    secure_bytes iv, tag;
+
+    // Warm up once so context creation is not measured
+    if (auto warmup = provider.unwrap()->encrypt(sample, iv, tag); warmup.is_err()) {
+        return Result<double>::err(warmup.unwrap_err());
+    }
+
+    using clock = std::chrono::steady_clock;
+    const auto start = clock::now();
+    const auto deadline = start + std::chrono::milliseconds(duration_ms);
+    uint64_t bytes = 0;
+    clock::time_point now;
+    do {
+        iv.clear();
+        if (auto result = provider.unwrap()->encrypt(sample, iv, tag); result.is_err()) {
+            return Result<double>::err(result.unwrap_err());
+        }
+        bytes += sample_size;
+        now = clock::now();
+    } while (now < deadline);
+
+    const double seconds = std::chrono::duration<double>(now - start).count();
+    return Result<double>::ok(static_cast<double>(bytes) / seconds);
+}
+
+neonfs::Result<neonfs::security::CipherSuite> neonfs::security::EncryptionProviderFactory::select_cipher_suite(const bool misuse_resistant) {
+    if (misuse_resistant) {
+        if (!is_supported(CipherSuite::AES_256_GCM_SIV)) {
+            return Result<CipherSuite>::err("AES-256-GCM-SIV is not supported by the linked OpenSSL");
+        }
+        return Result<CipherSuite>::ok(CipherSuite::AES_256_GCM_SIV);
+    }
+
+    // Decided once per process: CPU features do not change, and benchmarking is not free
+    static const CipherSuite fastest = [] {
+        if (const auto hardware_aes = has_hardware_aes()) {
+            return *hardware_aes ? CipherSuite::AES_256_GCM : CipherSuite::CHACHA20_POLY1305;
+        }
+
+        const auto aes = measure_throughput(CipherSuite::AES_256_GCM, 16 * 1024, 20);
+        const auto chacha = measure_throughput(CipherSuite::CHACHA20_POLY1305, 16 * 1024, 20);
+        if (aes.is_ok() && chacha.is_ok() && chacha.unwrap() > aes.unwrap()) {
+            return CipherSuite::CHACHA20_POLY1305;
+        }
+        return CipherSuite::AES_256_GCM;
+    }();
+
+    return Result<CipherSuite>::ok(fastest);
+}
+
+neonfs::Result<std::unique_ptr<neonfs::IEncryptionProvider>> neonfs::security::EncryptionProviderFactory::create(const CipherSuite suite, secure_bytes &&key, const size_t poolMaxSize) {
+    using ProviderResult = Result<std::unique_ptr<IEncryptionProvider>>;
+
+    if (key.size() != 32) {
+        return ProviderResult::err("Key must be 256 bits (32 bytes).");
+    }
+
+    switch (suite) {
+        case CipherSuite::AES_256_GCM:
+            return ProviderResult::ok(std::make_unique<AESEncryptionProvider>(std::move(key), poolMaxSize));
+        case CipherSuite::CHACHA20_POLY1305:
+            return ProviderResult::ok(std::make_unique<ChaCha20Poly1305Provider>(std::move(key), poolMaxSize));
+        case CipherSuite::AES_256_GCM_SIV:
+            if (!AESGCMSIVProvider::is_available()) {
+                return ProviderResult::err("AES-256-GCM-SIV is not supported by the linked OpenSSL");
+            }
+            return ProviderResult::ok(std::make_unique<AESGCMSIVProvider>(std::move(key), poolMaxSize));
+    }
+    return ProviderResult::err("Unknown cipher suite");
+}
+
+neonfs::Result<std::unique_ptr<neonfs::IEncryptionProvider>> neonfs::security::EncryptionProviderFactory::create_fastest(secure_bytes &&key, const size_t poolMaxSize, const bool misuse_resistant, CipherSuite &outSuite) {
+    auto suite = select_cipher_suite(misuse_resistant);
+    if (suite.is_err()) {
+        return Result<std::unique_ptr<IEncryptionProvider>>::err(suite.unwrap_err());
+    }
+
+    outSuite = suite.unwrap();
+    return create(outSuite, std::move(key), poolMaxSize);
+}
+
+const char *neonfs::security::EncryptionProviderFactory::name(const CipherSuite suite) {
+    switch (suite) {
+        case CipherSuite::AES_256_GCM: return "AES-256-GCM";
+        case CipherSuite::CHACHA20_POLY1305: return "ChaCha20-Poly1305";
+        case CipherSuite::AES_256_GCM_SIV: return "AES-256-GCM-SIV";
+    }
+    return "unknown";
+}
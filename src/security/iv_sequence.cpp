@@ -0,0 +1,72 @@
+#include <NeonFS/security/iv_sequence.h>
+#include <limits>
+#include <thread>
+
+neonfs::security::IVSequence::IVSequence(const uint32_t fixedField, const uint64_t start, const uint64_t batchSize, ReserveCallback onReserve)
+    : fixedField_(fixedField), batchSize_(batchSize), onReserve_(std::move(onReserve)), highWaterMark_(start) {
+    if (batchSize_ == 0) throw std::invalid_argument("IV sequence batch size must be greater than 0.");
+}
+
+std::shared_ptr<neonfs::security::IVSequence> neonfs::security::IVSequence::create(const uint32_t fixedField, const uint64_t start, const uint64_t batchSize, ReserveCallback onReserve) {
+    return std::make_shared<IVSequence>(fixedField, start, batchSize, std::move(onReserve));
+}
+
+neonfs::Result<uint64_t> neonfs::security::IVSequence::next() {
+    // Threads hash onto a fixed set of lanes, so the lane lock is almost never contended
+    Lane& lane = lanes_[std::hash<std::thread::id>{}(std::this_thread::get_id()) % lane_count];
+    std::lock_guard<std::mutex> lock(lane.mutex);
+
+    if (lane.next == lane.end) {
+        if (auto reserved = reserve(lane); reserved.is_err()) {
+            return Result<uint64_t>::err(reserved.unwrap_err());
+        }
+    }
+
+    return Result<uint64_t>::ok(lane.next++);
+}
+
+neonfs::Result<void> neonfs::security::IVSequence::reserve(Lane &lane) {
+    std::lock_guard<std::mutex> lock(reserveMutex_);
+
+    if (highWaterMark_ > std::numeric_limits<uint64_t>::max() - batchSize_) {
+        return Result<void>::err("IV sequence exhausted: rotate the key");
+    }
+
+    const uint64_t begin = highWaterMark_;
+    const uint64_t end = begin + batchSize_;
+
+    // The new mark must be durable before any counter below it is used
+    if (onReserve_) {
+        if (auto persisted = onReserve_(end); persisted.is_err()) {
+            return persisted;
+        }
+    }
+
+    highWaterMark_ = end;
+    lane.next = begin;
+    lane.end = end;
+    return Result<void>::ok();
+}
+
+void neonfs::security::IVSequence::make_iv(const uint64_t counter, uint8_t *out) const {
+    make_iv(fixedField_, counter, out);
+}
+
+void neonfs::security::IVSequence::make_iv(const uint32_t fixedField, const uint64_t counter, uint8_t *out) {
+    // Big-endian fixed field followed by the big-endian invocation counter
+    for (int i = 0; i < 4; ++i) {
+        out[i] = static_cast<uint8_t>(fixedField >> (24 - 8 * i));
+    }
+    for (int i = 0; i < 8; ++i) {
+        out[4 + i] = static_cast<uint8_t>(counter >> (56 - 8 * i));
+    }
+}
+
+uint32_t neonfs::security::IVSequence::fixed_field() const {
+    return fixedField_;
+}
+
+uint64_t neonfs::security::IVSequence::high_water_mark() {
+    std::lock_guard<std::mutex> lock(reserveMutex_);
+    return highWaterMark_;
+}
@@ -0,0 +1,101 @@
+#include <NeonFS/security/key_cache.h>
+#include <algorithm>
+#include <stdexcept>
+
+neonfs::security::KeyCache::KeyCache(const std::chrono::milliseconds ttl, const size_t capacity) : ttl_(ttl), capacity(capacity) {
+    if (ttl.count() <= 0) throw std::invalid_argument("Key cache TTL must be greater than 0");
+    if (capacity == 0) throw std::invalid_argument("Key cache capacity must be greater than 0");
+}
+
+neonfs::security::KeyCache::~KeyCache() {
+    clear();
+}
+
+void neonfs::security::KeyCache::put(const std::string &volume, const secure_bytes &key) {
+    const auto now = Clock::now();
+    std::lock_guard<std::mutex> lock(mutex);
+    put_locked(volume, key, now);
+}
+
+void neonfs::security::KeyCache::put_locked(const std::string &volume, const secure_bytes &key, const Clock::time_point now) {
+    purge_expired_locked(now);
+
+    if (entries.size() >= capacity && !entries.contains(volume)) {
+        const auto oldest = std::min_element(entries.begin(), entries.end(),
+                                             [](const auto& a, const auto& b) { return a.second.expires < b.second.expires; });
+        entries.erase(oldest);
+    }
+    // Replacing the key frees the old buffer, which secure_allocator wipes
+    entries[volume] = Entry{key, now + ttl_};
+}
+
+std::optional<neonfs::secure_bytes> neonfs::security::KeyCache::get(const std::string &volume) {
+    std::lock_guard<std::mutex> lock(mutex);
+    purge_expired_locked(Clock::now());
+
+    const auto it = entries.find(volume);
+    if (it == entries.end()) return std::nullopt;
+    return it->second.key;
+}
+
+neonfs::Result<neonfs::secure_bytes> neonfs::security::KeyCache::get_or_unlock(const std::string &volume, const std::function<Result<secure_bytes>()> &unlock) {
+    std::unique_lock<std::mutex> lock(mutex);
+    for (;;) {
+        purge_expired_locked(Clock::now());
+        if (const auto it = entries.find(volume); it != entries.end()) {
+            return Result<secure_bytes>::ok(it->second.key);
+        }
+        // Another caller is deriving this key: wait for it rather than pay the KDF again
+        if (!unlocking.contains(volume)) break;
+        unlockFinished.wait(lock);
+    }
+    unlocking.insert(volume);
+    lock.unlock();
+
+    const auto finish = [&](const secure_bytes* key) {
+        lock.lock();
+        unlocking.erase(volume);
+        if (key) put_locked(volume, *key, Clock::now());
+        lock.unlock();
+        unlockFinished.notify_all();
+    };
+
+    std::optional<Result<secure_bytes>> unlocked;
+    try {
+        unlocked.emplace(unlock());
+    } catch (...) {
+        finish(nullptr);
+        throw;
+    }
+    finish(unlocked->is_ok() ? &unlocked->unwrap() : nullptr);
+    return std::move(*unlocked);
+}
+
+bool neonfs::security::KeyCache::evict(const std::string &volume) {
+    std::lock_guard<std::mutex> lock(mutex);
+    return entries.erase(volume) != 0;
+}
+
+void neonfs::security::KeyCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.clear();
+}
+
+size_t neonfs::security::KeyCache::purge_expired() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return purge_expired_locked(Clock::now());
+}
+
+size_t neonfs::security::KeyCache::size() {
+    std::lock_guard<std::mutex> lock(mutex);
+    purge_expired_locked(Clock::now());
+    return entries.size();
+}
+
+std::chrono::milliseconds neonfs::security::KeyCache::ttl() const {
+    return ttl_;
+}
+
+size_t neonfs::security::KeyCache::purge_expired_locked(const Clock::time_point now) {
+    return std::erase_if(entries, [now](const auto& entry) { return entry.second.expires <= now; });
+}
@@ -1,5 +1,85 @@
 #include <NeonFS/security/key_manager.h>
+#include <openssl/core_names.h>
+#include <openssl/err.h>
+#include <openssl/kdf.h>
 #include <openssl/rand.h>
+#include <algorithm>
+#include <memory>
+#include <mutex>
+
+#if OPENSSL_VERSION_NUMBER >= 0x30200000L && !defined(OPENSSL_NO_THREAD_POOL)
+#include <openssl/thread.h>
+#define NEONFS_HAS_OPENSSL_THREAD_POOL
+#endif
+
+namespace {
+    // Argon2 parameter names, spelled out because headers older than OpenSSL 3.2 do not define them
+    constexpr const char* argon2_lanes = "lanes";
+    constexpr const char* argon2_memory = "memcost";
+    constexpr const char* argon2_threads = "threads";
+
+    constexpr uint32_t calibration_min_memory_kib = 8 * 1024;
+    constexpr auto calibration_min_sample = std::chrono::milliseconds(50);
+    constexpr std::string_view verifier_label = "neonfs/password-verifier";
+    constexpr size_t verifier_size = 32;
+
+    // Fetched once; null if the default library context has no Argon2id
+    EVP_KDF* argon2_kdf() {
+        static EVP_KDF* kdf = EVP_KDF_fetch(nullptr, "ARGON2ID", nullptr);
+        return kdf;
+    }
+
+    EVP_KDF* hkdf_kdf() {
+        static EVP_KDF* kdf = EVP_KDF_fetch(nullptr, "HKDF", nullptr);
+        return kdf;
+    }
+
+    // Grows OpenSSL's thread pool so Argon2 can fill `threads` lanes at once
+    void reserve_threads(const uint32_t threads) {
+#if defined(NEONFS_HAS_OPENSSL_THREAD_POOL)
+        static std::mutex mutex;
+        std::lock_guard<std::mutex> lock(mutex);
+        if (OSSL_get_max_threads(nullptr) < threads) OSSL_set_max_threads(nullptr, threads);
+#else
+        (void)threads;
+#endif
+    }
+
+    bool argon2_derive(const neonfs::secure_bytes& password, const neonfs::secure_bytes& salt, neonfs::secure_bytes& out,
+                       const neonfs::security::Argon2Params& params, uint32_t threads) {
+        const std::unique_ptr<EVP_KDF_CTX, decltype(&EVP_KDF_CTX_free)> ctx(EVP_KDF_CTX_new(argon2_kdf()), EVP_KDF_CTX_free);
+        if (!ctx) return false;
+
+        uint32_t iterations = params.iterations;
+        uint32_t lanes = params.lanes;
+        uint32_t memory = params.memory_kib;
+        const OSSL_PARAM ossl_params[] = {
+            OSSL_PARAM_construct_octet_string(OSSL_KDF_PARAM_PASSWORD, const_cast<uint8_t*>(password.data()), password.size()),
+            OSSL_PARAM_construct_octet_string(OSSL_KDF_PARAM_SALT, const_cast<uint8_t*>(salt.data()), salt.size()),
+            OSSL_PARAM_construct_uint32(OSSL_KDF_PARAM_ITER, &iterations),
+            OSSL_PARAM_construct_uint32(argon2_lanes, &lanes),
+            OSSL_PARAM_construct_uint32(argon2_memory, &memory),
+            OSSL_PARAM_construct_uint32(argon2_threads, &threads),
+            OSSL_PARAM_construct_end()
+        };
+        return EVP_KDF_derive(ctx.get(), out.data(), out.size(), ossl_params) == 1;
+    }
+
+    // Checks a freshly derived key against a stored verifier, handing the key back only on a match
+    neonfs::Result<std::optional<neonfs::secure_bytes>> check_verifier(neonfs::Result<neonfs::secure_bytes> derived, const neonfs::secure_bytes& verifier) {
+        using Checked = neonfs::Result<std::optional<neonfs::secure_bytes>>;
+        if (derived.is_err()) return Checked::err(derived.unwrap_err());
+
+        neonfs::secure_bytes key = derived.unwrap_move();
+        auto computed = neonfs::security::KeyManager::make_verifier(key);
+        if (computed.is_err()) return Checked::err(computed.unwrap_err());
+
+        if (CRYPTO_memcmp(computed.unwrap().data(), verifier.data(), verifier_size) != 0) {
+            return Checked::ok(std::nullopt);
+        }
+        return Checked::ok(std::move(key));
+    }
+}
 
 neonfs::Result<neonfs::secure_bytes> neonfs::security::KeyManager::generate_master_key(const size_t size = 32) {
     if (size == 0 || size > 512) {
@@ -29,6 +109,9 @@ neonfs::Result<neonfs::secure_bytes> neonfs::security::KeyManager::derive_key(co
     if (password.empty() || salt.empty() || derived_key_size == 0) {
         return Result<secure_bytes>::err("Invalid input parameters");
     }
+    if (algorithm == KeyDerivationAlgorithm::ARGON2ID) {
+        return Result<secure_bytes>::err("Argon2id requires Argon2Params");
+    }
 
     secure_bytes derived_key(derived_key_size);
 
@@ -60,6 +143,9 @@ neonfs::Result<bool> neonfs::security::KeyManager::verify_password(const secure_
     if (expected_derived_key.size() != derived_key_size) {
         return Result<bool>::err("Expected key size mismatch");
     }
+    if (algorithm == KeyDerivationAlgorithm::ARGON2ID) {
+        return Result<bool>::err("Argon2id requires Argon2Params");
+    }
 
     try {
         // Derive key from provided password and salt
@@ -89,3 +175,168 @@ neonfs::Result<bool> neonfs::security::KeyManager::verify_password(const secure_
         return Result<bool>::err(std::string("Verification failed: ") + e.what());
     }
 }
+
+neonfs::Result<unsigned> neonfs::security::KeyManager::calibrate_pbkdf2(const std::chrono::milliseconds target, const KeyDerivationAlgorithm algorithm) {
+    if (target.count() <= 0) {
+        return Result<unsigned>::err("Invalid calibration parameters");
+    }
+    if (algorithm == KeyDerivationAlgorithm::ARGON2ID) {
+        return Result<unsigned>::err("Use calibrate_argon2 for Argon2id");
+    }
+
+    const secure_bytes password(16, 0x70);
+    const secure_bytes salt(16, 0x73);
+    // Short samples are dominated by timer and setup noise, so double the work until one is long enough
+    for (unsigned iterations = 1000;; iterations *= 2) {
+        const auto start = std::chrono::steady_clock::now();
+        if (auto key = derive_key(password, salt, 32, algorithm, iterations); key.is_err()) {
+            return Result<unsigned>::err(key.unwrap_err());
+        }
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+
+        if (elapsed >= calibration_min_sample || iterations >= 0x40000000u) {
+            const double rate = iterations / std::chrono::duration<double>(elapsed).count();
+            const double recommended = rate * std::chrono::duration<double>(target).count();
+            return Result<unsigned>::ok(static_cast<unsigned>(std::clamp(recommended, 1.0, 4294967295.0)));
+        }
+    }
+}
+
+bool neonfs::security::KeyManager::argon2_available() {
+    return argon2_kdf() != nullptr;
+}
+
+neonfs::Result<neonfs::secure_bytes> neonfs::security::KeyManager::derive_key(const secure_bytes &password, const secure_bytes &salt, const size_t derived_key_size, const Argon2Params &params) {
+    // Limits from RFC 9106
+    if (password.empty() || salt.size() < 8 || derived_key_size < 4) {
+        return Result<secure_bytes>::err("Invalid input parameters");
+    }
+    if (params.iterations == 0 || params.lanes == 0 || params.lanes > 0xFFFFFF || params.memory_kib < 8 * params.lanes) {
+        return Result<secure_bytes>::err("Invalid Argon2id parameters");
+    }
+    if (!argon2_available()) {
+        return Result<secure_bytes>::err("Argon2id is not supported by this OpenSSL build");
+    }
+
+    const uint32_t threads = std::min(params.threads == 0 ? params.lanes : params.threads, params.lanes);
+    if (threads > 1) reserve_threads(threads);
+
+    secure_bytes derived_key(derived_key_size);
+    // The pool may be busy with other derivations; the lanes then run on this thread instead
+    if (!argon2_derive(password, salt, derived_key, params, threads)) {
+        ERR_clear_error();
+        if (threads == 1 || !argon2_derive(password, salt, derived_key, params, 1)) {
+            return Result<secure_bytes>::err("Key derivation failed (ARGON2ID)");
+        }
+    }
+    return Result<secure_bytes>::ok(derived_key);
+}
+
+neonfs::Result<bool> neonfs::security::KeyManager::verify_password(const secure_bytes &password, const secure_bytes &salt, const secure_bytes &expected_derived_key, const size_t derived_key_size, const Argon2Params &params) {
+    if (derived_key_size == 0 || derived_key_size > 64) {
+        return Result<bool>::err("Invalid derived key size");
+    }
+    if (expected_derived_key.size() != derived_key_size) {
+        return Result<bool>::err("Expected key size mismatch");
+    }
+
+    try {
+        auto derived = derive_key(password, salt, derived_key_size, params);
+        if (derived.is_err()) {
+            return Result<bool>::err("Key derivation failed during verification: " + std::string(derived.unwrap_err().message()));
+        }
+
+        secure_bytes derived_key = derived.unwrap_move();
+        const bool matches = CRYPTO_memcmp(derived_key.data(), expected_derived_key.data(), derived_key_size) == 0;
+        OPENSSL_cleanse(derived_key.data(), derived_key.size());
+        return Result<bool>::ok(matches);
+    } catch (const std::exception& e) {
+        return Result<bool>::err(std::string("Verification failed: ") + e.what());
+    }
+}
+
+neonfs::Result<neonfs::security::Argon2Params> neonfs::security::KeyManager::calibrate_argon2(const std::chrono::milliseconds target, const uint32_t memory_kib, const uint32_t lanes) {
+    if (target.count() <= 0 || lanes == 0) {
+        return Result<Argon2Params>::err("Invalid calibration parameters");
+    }
+    if (!argon2_available()) {
+        return Result<Argon2Params>::err("Argon2id is not supported by this OpenSSL build");
+    }
+
+    Argon2Params params;
+    params.lanes = lanes;
+    params.memory_kib = std::max(memory_kib, 8 * lanes);
+    params.iterations = 1;
+
+    const secure_bytes password(16, 0x70);
+    const secure_bytes salt(16, 0x73);
+    auto time_pass = [&]() -> Result<std::chrono::nanoseconds> {
+        const auto start = std::chrono::steady_clock::now();
+        auto key = derive_key(password, salt, 32, params);
+        if (key.is_err()) return Result<std::chrono::nanoseconds>::err(key.unwrap_err());
+        return Result<std::chrono::nanoseconds>::ok(std::chrono::steady_clock::now() - start);
+    };
+
+    auto pass = time_pass();
+    while (pass.is_ok() && pass.unwrap() > target && params.memory_kib / 2 >= std::max(calibration_min_memory_kib, 8 * lanes)) {
+        params.memory_kib /= 2;
+        pass = time_pass();
+    }
+    if (pass.is_err()) {
+        return Result<Argon2Params>::err(pass.unwrap_err());
+    }
+
+    // Each pass costs about the same, so the remaining budget buys whole passes
+    const auto per_pass = std::max<std::chrono::nanoseconds>(pass.unwrap(), std::chrono::nanoseconds(1));
+    const auto passes = std::chrono::duration_cast<std::chrono::nanoseconds>(target).count() / per_pass.count();
+    params.iterations = static_cast<uint32_t>(std::clamp<int64_t>(passes, 1, 0xFFFFFFFF));
+    return Result<Argon2Params>::ok(params);
+}
+
+neonfs::Result<neonfs::secure_bytes> neonfs::security::KeyManager::derive_subkey(const secure_bytes &master_key, const std::string_view label, const secure_bytes &context, const size_t subkey_size) {
+    if (master_key.empty() || label.empty() || subkey_size == 0 || subkey_size > 255 * 32) {
+        return Result<secure_bytes>::err("Invalid input parameters");
+    }
+
+    const std::unique_ptr<EVP_KDF_CTX, decltype(&EVP_KDF_CTX_free)> ctx(hkdf_kdf() ? EVP_KDF_CTX_new(hkdf_kdf()) : nullptr, EVP_KDF_CTX_free);
+    if (!ctx) {
+        return Result<secure_bytes>::err("Failed to create HKDF context");
+    }
+
+    // The label is NUL-terminated so that no label/context split can collide with another
+    secure_bytes info(label.begin(), label.end());
+    info.push_back(0);
+    info.insert(info.end(), context.begin(), context.end());
+
+    char digest[] = "SHA256";
+    const OSSL_PARAM params[] = {
+        OSSL_PARAM_construct_utf8_string(OSSL_KDF_PARAM_DIGEST, digest, 0),
+        OSSL_PARAM_construct_octet_string(OSSL_KDF_PARAM_KEY, const_cast<uint8_t*>(master_key.data()), master_key.size()),
+        OSSL_PARAM_construct_octet_string(OSSL_KDF_PARAM_INFO, info.data(), info.size()),
+        OSSL_PARAM_construct_end()
+    };
+
+    secure_bytes subkey(subkey_size);
+    if (EVP_KDF_derive(ctx.get(), subkey.data(), subkey.size(), params) != 1) {
+        return Result<secure_bytes>::err("Subkey derivation failed (HKDF-SHA256)");
+    }
+    return Result<secure_bytes>::ok(subkey);
+}
+
+neonfs::Result<neonfs::secure_bytes> neonfs::security::KeyManager::make_verifier(const secure_bytes &derived_key) {
+    return derive_subkey(derived_key, verifier_label, {}, verifier_size);
+}
+
+neonfs::Result<std::optional<neonfs::secure_bytes>> neonfs::security::KeyManager::verify_and_derive(const secure_bytes &password, const secure_bytes &salt, const secure_bytes &verifier, const size_t derived_key_size, const KeyDerivationAlgorithm algorithm, const unsigned iterations) {
+    if (verifier.size() != verifier_size) {
+        return Result<std::optional<secure_bytes>>::err("Invalid verifier size");
+    }
+    return check_verifier(derive_key(password, salt, derived_key_size, algorithm, iterations), verifier);
+}
+
+neonfs::Result<std::optional<neonfs::secure_bytes>> neonfs::security::KeyManager::verify_and_derive(const secure_bytes &password, const secure_bytes &salt, const secure_bytes &verifier, const size_t derived_key_size, const Argon2Params &params) {
+    if (verifier.size() != verifier_size) {
+        return Result<std::optional<secure_bytes>>::err("Invalid verifier size");
+    }
+    return check_verifier(derive_key(password, salt, derived_key_size, params), verifier);
+}
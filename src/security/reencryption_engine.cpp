@@ -0,0 +1,215 @@
+#include <NeonFS/security/reencryption_engine.h>
+#include <NeonFS/security/block_crypto.h>
+#include <algorithm>
+#include <stdexcept>
+
+namespace {
+    bool same_block(const neonfs::BlockInfo& a, const neonfs::BlockInfo& b) {
+        return a.blockId == b.blockId && a.iv == b.iv && a.tag == b.tag && a.generation == b.generation && a.keyVersion == b.keyVersion;
+    }
+}
+
+neonfs::security::ReencryptionEngine::ReencryptionEngine(IMetadataProvider &metadata, IStorageProvider &storage, FileLockTable &locks, ReencryptionConfig config)
+    : metadata(metadata), storage(storage), locks(locks), config(std::move(config)),
+      bytesBucket(this->config.bytesPerSecond, std::max(this->config.bytesPerSecond, 1.0)),
+      blocksBucket(this->config.blocksPerSecond, std::max(this->config.blocksPerSecond, 1.0)) {
+    if (!this->config.resolveKey) throw std::invalid_argument("Re-encryption needs a key resolver");
+}
+
+neonfs::security::ReencryptionEngine::~ReencryptionEngine() {
+    stop();
+    if (worker.joinable()) worker.join();
+}
+
+neonfs::Result<void> neonfs::security::ReencryptionEngine::run() {
+    if (config.resumeFrom) {
+        if (config.resumeFrom->targetVersion != config.targetVersion) {
+            return Result<void>::err("Checkpoint is for key version " + std::to_string(config.resumeFrom->targetVersion));
+        }
+        state = *config.resumeFrom;
+        if (state.pending) {
+            if (auto recovered = recover(*state.pending); recovered.is_err()) return recovered;
+            state.pending.reset();
+            if (auto saved = checkpoint(); saved.is_err()) return saved;
+        }
+    }
+    state.targetVersion = config.targetVersion;
+
+    std::vector<uint64_t> ids = metadata.listMetadataIds();
+    std::sort(ids.begin(), ids.end());
+    for (const uint64_t fileId : ids) {
+        if (fileId < state.nextFileId) continue;
+
+        if (auto done = reencrypt_file(fileId); done.is_err()) return done;
+        // A stop inside the file leaves it to be rescanned; its finished blocks are skipped then
+        if (stopRequested.load(std::memory_order_relaxed)) return Result<void>::ok();
+
+        state.nextFileId = fileId + 1;
+        filesScanned.fetch_add(1, std::memory_order_relaxed);
+        if (auto saved = checkpoint(); saved.is_err()) return saved;
+    }
+
+    finished.store(true, std::memory_order_release);
+    return Result<void>::ok();
+}
+
+void neonfs::security::ReencryptionEngine::start() {
+    if (worker.joinable()) return;
+    stopRequested.store(false, std::memory_order_relaxed);
+    outcome.reset();
+    worker = std::thread([this] { outcome = run(); });
+}
+
+void neonfs::security::ReencryptionEngine::stop() {
+    stopRequested.store(true, std::memory_order_relaxed);
+}
+
+neonfs::Result<void> neonfs::security::ReencryptionEngine::wait() {
+    if (worker.joinable()) worker.join();
+    if (!outcome) return Result<void>::err("Re-encryption job was not started");
+    return *outcome;
+}
+
+neonfs::security::ReencryptionProgress neonfs::security::ReencryptionEngine::progress() const {
+    ReencryptionProgress progress;
+    progress.filesScanned = filesScanned.load(std::memory_order_relaxed);
+    progress.blocksReencrypted = blocksReencrypted.load(std::memory_order_relaxed);
+    progress.blocksSkipped = blocksSkipped.load(std::memory_order_relaxed);
+    progress.bytesReencrypted = bytesReencrypted.load(std::memory_order_relaxed);
+    progress.finished = finished.load(std::memory_order_acquire);
+    return progress;
+}
+
+void neonfs::security::ReencryptionEngine::set_limits(const double bytesPerSecond, const double blocksPerSecond) {
+    bytesBucket.set_rate(bytesPerSecond);
+    blocksBucket.set_rate(blocksPerSecond);
+}
+
+neonfs::Result<std::shared_ptr<neonfs::IEncryptionProvider>> neonfs::security::ReencryptionEngine::provider(const uint32_t keyVersion) {
+    if (const auto it = providers.find(keyVersion); it != providers.end()) {
+        return Result<std::shared_ptr<IEncryptionProvider>>::ok(it->second);
+    }
+    auto resolved = config.resolveKey(keyVersion);
+    if (resolved.is_err()) return resolved;
+    if (!resolved.unwrap()) {
+        return Result<std::shared_ptr<IEncryptionProvider>>::err(ErrorKind::NotFound, "No key for version");
+    }
+    providers.emplace(keyVersion, resolved.unwrap());
+    return resolved;
+}
+
+neonfs::Result<void> neonfs::security::ReencryptionEngine::recover(const ReencryptionCheckpoint::PendingBlock &pending) {
+    const auto lock = locks.lock_exclusive(pending.fileId);
+    Metadata meta;
+    try {
+        meta = metadata.getMetadata(pending.fileId);
+    } catch (const std::out_of_range&) {
+        return Result<void>::ok();  // Deleted since
+    }
+    if (pending.blockIndex >= meta.blocks.size()) return Result<void>::ok();
+
+    BlockInfo& block = meta.blocks[pending.blockIndex];
+    // Already committed, or rewritten by the foreground after the crash point: nothing to undo
+    if (!same_block(block, pending.before)) return Result<void>::ok();
+
+    auto cipher = read_block_cipher(storage, meta, block);
+    if (cipher.is_err()) return Result<void>::err(cipher.unwrap_err());
+
+    auto target = provider(pending.after.keyVersion);
+    if (target.is_err()) return Result<void>::err(target.unwrap_err());
+    if (decrypt_block(*target.unwrap(), pending.after, cipher.unwrap()).is_ok()) {
+        // The new ciphertext landed but the metadata did not
+        block = pending.after;
+        metadata.upsertMetadata(meta);
+        return Result<void>::ok();
+    }
+
+    // The write never happened or was torn: put the old ciphertext back
+    std::unique_lock<std::mutex> blockLock;
+    if (block.packed) blockLock = locks.lock_block(block.blockId);
+    return write_block_cipher(storage, block, pending.oldCiphertext);
+}
+
+neonfs::Result<void> neonfs::security::ReencryptionEngine::reencrypt_file(const uint64_t fileId) {
+    const uint64_t blockSize = storage.getBlockSize();
+    uint64_t chunkSize = blockSize;     // Of the file as last seen; only sizes the throttle
+    for (size_t index = 0;; ++index) {
+        if (stopRequested.load(std::memory_order_relaxed)) return Result<void>::ok();
+
+        // Throttle before taking the lock so that waiting never blocks foreground access
+        blocksBucket.acquire(1);
+        bytesBucket.acquire(2.0 * static_cast<double>(chunkSize));
+
+        const auto lock = locks.lock_exclusive(fileId);
+        Metadata meta;
+        try {
+            meta = metadata.getMetadata(fileId);
+        } catch (const std::out_of_range&) {
+            return Result<void>::ok();
+        }
+        if (meta.isDirectory || index >= meta.blocks.size()) return Result<void>::ok();
+        chunkSize = chunk_size(meta, blockSize);
+
+        BlockInfo& block = meta.blocks[index];
+        if (block.keyVersion == config.targetVersion) {
+            blocksSkipped.fetch_add(1, std::memory_order_relaxed);
+            continue;
+        }
+
+        const size_t length = block_cipher_length(meta, block, blockSize);
+        if (length == 0) {
+            return Result<void>::err(ErrorKind::OutOfRange, "Block lies beyond the end of the file");
+        }
+
+        auto source = provider(block.keyVersion);
+        if (source.is_err()) return Result<void>::err(source.unwrap_err());
+        auto target = provider(config.targetVersion);
+        if (target.is_err()) return Result<void>::err(target.unwrap_err());
+
+        auto cipher = read_block_cipher(storage, meta, block);
+        if (cipher.is_err()) return Result<void>::err(cipher.unwrap_err());
+
+        auto plain = decrypt_block(*source.unwrap(), block, cipher.unwrap());
+        if (plain.is_err()) return Result<void>::err(plain.unwrap_err());
+
+        secure_bytes iv;
+        secure_bytes tag;
+        auto reencrypted = target.unwrap()->encrypt(plain.unwrap(), iv, tag);
+        if (reencrypted.is_err()) return Result<void>::err(reencrypted.unwrap_err());
+
+        BlockInfo after = block;
+        after.iv.assign(iv.begin(), iv.end());
+        after.tag.assign(tag.begin(), tag.end());
+        after.generation = 0;
+        after.keyVersion = config.targetVersion;
+
+        if (block.blockCount == 0) {
+            // Inline: the metadata upsert replaces the ciphertext in one step, so there is nothing to undo
+            after.inlineData.assign(reencrypted.unwrap().begin(), reencrypted.unwrap().end());
+        } else {
+            // Persist the undo record before the old ciphertext is overwritten
+            state.pending = ReencryptionCheckpoint::PendingBlock{fileId, index, block, after,
+                                                                 std::vector<uint8_t>(cipher.unwrap().begin(), cipher.unwrap().end())};
+            if (auto saved = checkpoint(); saved.is_err()) {
+                state.pending.reset();
+                return saved;
+            }
+
+            std::unique_lock<std::mutex> blockLock;
+            if (block.packed) blockLock = locks.lock_block(block.blockId);
+            if (auto written = write_block_cipher(storage, block, reencrypted.unwrap()); written.is_err()) return written;
+        }
+
+        block = after;
+        metadata.upsertMetadata(meta);
+        state.pending.reset();
+
+        blocksReencrypted.fetch_add(1, std::memory_order_relaxed);
+        bytesReencrypted.fetch_add(length, std::memory_order_relaxed);
+    }
+}
+
+neonfs::Result<void> neonfs::security::ReencryptionEngine::checkpoint() {
+    if (!config.onCheckpoint) return Result<void>::ok();
+    return config.onCheckpoint(state);
+}
@@ -0,0 +1,137 @@
+#include <NeonFS/security/stream_aead.h>
+#include <openssl/rand.h>
+#include <algorithm>
+#include <limits>
+
+neonfs::security::StreamLayout::StreamLayout(const size_t segmentSize, const size_t tagSize) : segmentSize_(segmentSize), tagSize_(tagSize) {}
+
+size_t neonfs::security::StreamLayout::segment_size() const {
+    return segmentSize_;
+}
+
+size_t neonfs::security::StreamLayout::encrypted_segment_size() const {
+    return segmentSize_ + tagSize_;
+}
+
+uint64_t neonfs::security::StreamLayout::segment_count(const uint64_t plaintextSize) const {
+    if (plaintextSize == 0) return 1;
+    return (plaintextSize + segmentSize_ - 1) / segmentSize_;
+}
+
+uint64_t neonfs::security::StreamLayout::ciphertext_size(const uint64_t plaintextSize) const {
+    return plaintextSize + segment_count(plaintextSize) * tagSize_;
+}
+
+uint64_t neonfs::security::StreamLayout::ciphertext_offset(const uint64_t segmentIndex) const {
+    return segmentIndex * encrypted_segment_size();
+}
+
+void neonfs::security::StreamLayout::make_segment_iv(const uint8_t *noncePrefix, const uint32_t segmentIndex, const bool last, uint8_t *out) {
+    std::copy_n(noncePrefix, nonce_prefix_size, out);
+    for (int i = 0; i < 4; ++i) {
+        out[nonce_prefix_size + i] = static_cast<uint8_t>(segmentIndex >> (24 - 8 * i));
+    }
+    out[segment_iv_size - 1] = last ? 0x01 : 0x00;
+}
+
+neonfs::security::StreamEncryptor::StreamEncryptor(IEncryptionProvider &provider, StreamLayout layout, secure_bytes header)
+    : provider_(&provider), layout_(layout), header_(std::move(header)) {}
+
+neonfs::Result<neonfs::security::StreamEncryptor> neonfs::security::StreamEncryptor::create(IEncryptionProvider &provider, const size_t segmentSize) {
+    if (provider.iv_size() != StreamLayout::segment_iv_size) {
+        return Result<StreamEncryptor>::err("Stream encryption requires a provider with 12-byte IVs");
+    }
+    if (segmentSize == 0) {
+        return Result<StreamEncryptor>::err("Segment size must be greater than 0");
+    }
+
+    secure_bytes header(StreamLayout::nonce_prefix_size);
+    if (RAND_bytes(header.data(), static_cast<int>(header.size())) != 1) {
+        return Result<StreamEncryptor>::err("Failed to generate stream nonce prefix");
+    }
+
+    return Result<StreamEncryptor>::ok(StreamEncryptor(provider, StreamLayout(segmentSize, provider.tag_size()), std::move(header)));
+}
+
+const neonfs::secure_bytes &neonfs::security::StreamEncryptor::header() const {
+    return header_;
+}
+
+const neonfs::security::StreamLayout &neonfs::security::StreamEncryptor::layout() const {
+    return layout_;
+}
+
+neonfs::Result<neonfs::secure_bytes> neonfs::security::StreamEncryptor::encrypt_segment(const secure_bytes &plain, const bool last) {
+    if (finished_) {
+        return Result<secure_bytes>::err("Stream already finished");
+    }
+    if (plain.size() > layout_.segment_size() || (!last && plain.size() != layout_.segment_size())) {
+        return Result<secure_bytes>::err("Invalid segment size: only the last segment may be short");
+    }
+    if (nextSegment_ > std::numeric_limits<uint32_t>::max()) {
+        return Result<secure_bytes>::err("Stream exceeds the maximum number of segments");
+    }
+
+    secure_bytes iv(StreamLayout::segment_iv_size);
+    StreamLayout::make_segment_iv(header_.data(), static_cast<uint32_t>(nextSegment_), last, iv.data());
+
+    secure_bytes tag;
+    auto encrypted = provider_->encrypt(plain, iv, tag);
+    if (encrypted.is_err()) {
+        return encrypted;
+    }
+
+    // Advance only once the segment is produced; a failed encrypt emits nothing under this IV
+    ++nextSegment_;
+    finished_ = last;
+
+    secure_bytes segment = encrypted.unwrap_move();
+    segment.insert(segment.end(), tag.begin(), tag.end());
+    return Result<secure_bytes>::ok(std::move(segment));
+}
+
+bool neonfs::security::StreamEncryptor::finished() const {
+    return finished_;
+}
+
+neonfs::security::StreamDecryptor::StreamDecryptor(IEncryptionProvider &provider, StreamLayout layout, secure_bytes header)
+    : provider_(&provider), layout_(layout), header_(std::move(header)) {}
+
+neonfs::Result<neonfs::security::StreamDecryptor> neonfs::security::StreamDecryptor::create(IEncryptionProvider &provider, const size_t segmentSize, const secure_bytes &header) {
+    if (provider.iv_size() != StreamLayout::segment_iv_size) {
+        return Result<StreamDecryptor>::err("Stream decryption requires a provider with 12-byte IVs");
+    }
+    if (segmentSize == 0) {
+        return Result<StreamDecryptor>::err("Segment size must be greater than 0");
+    }
+    if (header.size() != StreamLayout::nonce_prefix_size) {
+        return Result<StreamDecryptor>::err("Invalid stream header");
+    }
+
+    return Result<StreamDecryptor>::ok(StreamDecryptor(provider, StreamLayout(segmentSize, provider.tag_size()), header));
+}
+
+const neonfs::security::StreamLayout &neonfs::security::StreamDecryptor::layout() const {
+    return layout_;
+}
+
+neonfs::Result<neonfs::secure_bytes> neonfs::security::StreamDecryptor::decrypt_segment(const uint64_t segmentIndex, const secure_bytes &encryptedSegment, const bool last) {
+    if (segmentIndex > std::numeric_limits<uint32_t>::max()) {
+        return Result<secure_bytes>::err("Segment index out of range");
+    }
+
+    const size_t tagSize = provider_->tag_size();
+    if (encryptedSegment.size() < tagSize || encryptedSegment.size() > layout_.encrypted_segment_size() ||
+        (!last && encryptedSegment.size() != layout_.encrypted_segment_size())) {
+        return Result<secure_bytes>::err("Invalid encrypted segment size");
+    }
+
+    const auto tagBegin = encryptedSegment.end() - static_cast<std::ptrdiff_t>(tagSize);
+    const secure_bytes cipher(encryptedSegment.begin(), tagBegin);
+    secure_bytes tag(tagBegin, encryptedSegment.end());
+
+    secure_bytes iv(StreamLayout::segment_iv_size);
+    StreamLayout::make_segment_iv(header_.data(), static_cast<uint32_t>(segmentIndex), last, iv.data());
+
+    return provider_->decrypt(cipher, iv, tag);
+}
@@ -0,0 +1,68 @@
+#include <NeonFS/storage/block_allocator.h>
+
+neonfs::storage::BlockAllocator::BlockAllocator(const uint64_t blockCount)
+    : used(blockCount, false), freeBlocks(blockCount) {}
+
+neonfs::Result<uint64_t> neonfs::storage::BlockAllocator::allocate() {
+    return allocate(1);
+}
+
+neonfs::Result<uint64_t> neonfs::storage::BlockAllocator::allocate(const uint64_t count) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (count == 0) return Result<uint64_t>::err(ErrorKind::InvalidArgument, "Cannot allocate zero blocks");
+    if (freeBlocks < count) return Result<uint64_t>::err(ErrorKind::ResourceExhausted, "No free blocks");
+
+    // Next-fit: runs do not wrap, so the scan restarts at 0 once past the end
+    const uint64_t total = used.size();
+    uint64_t start = next;
+    uint64_t run = 0;
+    for (uint64_t step = 0; step < total + count; ++step) {
+        const uint64_t candidate = (next + step) % total;
+        if (candidate == 0) run = 0;
+        if (used[candidate]) {
+            run = 0;
+            continue;
+        }
+        if (run == 0) start = candidate;
+        if (++run < count) continue;
+
+        for (uint64_t id = start; id < start + count; ++id) used[id] = true;
+        freeBlocks -= count;
+        next = (start + count) % total;
+        return Result<uint64_t>::ok(start);
+    }
+    return Result<uint64_t>::err(ErrorKind::ResourceExhausted, "No run of free blocks");
+}
+
+void neonfs::storage::BlockAllocator::release(const uint64_t blockId) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (blockId >= used.size() || !used[blockId]) return;
+    used[blockId] = false;
+    ++freeBlocks;
+}
+
+void neonfs::storage::BlockAllocator::release(const uint64_t firstBlockId, const uint64_t count) {
+    for (uint64_t id = firstBlockId; id < firstBlockId + count; ++id) release(id);
+}
+
+bool neonfs::storage::BlockAllocator::mark_used(const uint64_t blockId) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (blockId >= used.size() || used[blockId]) return false;
+    used[blockId] = true;
+    --freeBlocks;
+    return true;
+}
+
+bool neonfs::storage::BlockAllocator::is_used(const uint64_t blockId) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return blockId < used.size() && used[blockId];
+}
+
+uint64_t neonfs::storage::BlockAllocator::free_count() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return freeBlocks;
+}
+
+uint64_t neonfs::storage::BlockAllocator::block_count() const noexcept {
+    return used.size();
+}
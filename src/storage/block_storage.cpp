@@ -86,48 +86,58 @@ neonfs::Result<void> neonfs::storage::BlockStorage::create(std::string path, Blo
 }
 
 neonfs::Result<std::vector<unsigned char> > neonfs::storage::BlockStorage::readBlock(uint64_t blockID) {
+    std::vector<uint8_t> data(block_size_);
+    auto read = readBlockInto(blockID, data);
+    if (read.is_err()) return Result<std::vector<uint8_t>>::err(read.unwrap_err());
+    return Result<std::vector<uint8_t>>::ok(std::move(data));
+}
+
+neonfs::Result<std::span<uint8_t>> neonfs::storage::BlockStorage::readBlockInto(const uint64_t blockID, const std::span<uint8_t> buffer) {
     std::lock_guard<std::mutex> lock(file_stream_mutex);
     if (!is_mounted) {
-        return Result<std::vector<uint8_t>>::err("Storage is not mounted", -1);
+        return Result<std::span<uint8_t>>::err(ErrorKind::NotMounted, "Storage is not mounted", -1);
     }
 
     if (blockID >= getBlockCount()) {
-        return Result<std::vector<uint8_t>>::err("Invalid block ID", -2);
+        return Result<std::span<uint8_t>>::err(ErrorKind::OutOfRange, "Invalid block ID", -2);
+    }
+
+    if (buffer.size() < block_size_) {
+        return Result<std::span<uint8_t>>::err(ErrorKind::InvalidArgument, "Buffer is smaller than a block", -5);
     }
 
     const uint64_t offset = blockID * block_size_;
     filestream.seekg(offset, std::ios::beg);
     if (!filestream.good()) {
-        return Result<std::vector<uint8_t>>::err("Failed to seek to block position", -3);
+        return Result<std::span<uint8_t>>::err(ErrorKind::Io, "Failed to seek to block position", -3);
     }
 
-    std::vector<uint8_t> data(block_size_);
-    filestream.read(reinterpret_cast<char*>(data.data()), block_size_);
+    filestream.read(reinterpret_cast<char*>(buffer.data()), block_size_);
     if (filestream.gcount() != static_cast<std::streamsize>(block_size_)) {
-        return Result<std::vector<uint8_t>>::err("Incomplete block read", -4);
+        return Result<std::span<uint8_t>>::err(ErrorKind::Io, "Incomplete block read", -4);
     }
 
-    return Result<std::vector<uint8_t>>::ok(std::move(data));
+    return Result<std::span<uint8_t>>::ok(buffer.first(block_size_));
 }
 
 neonfs::Result<void> neonfs::storage::BlockStorage::writeBlock(uint64_t blockID, std::vector<uint8_t> &data) {
     if (!is_mounted) {
-        return Result<void>::err("Storage is not mounted", -1);
+        return Result<void>::err(ErrorKind::NotMounted, "Storage is not mounted", -1);
     }
 
     if (blockID >= getBlockCount()) {
-        return Result<void>::err("Invalid block ID", -2);
+        return Result<void>::err(ErrorKind::OutOfRange, "Invalid block ID", -2);
     }
 
     if (data.size() > block_size_ ) {
-        return Result<void>::err("Data size exceeds block size", -3);
+        return Result<void>::err(ErrorKind::InvalidArgument, "Data size exceeds block size", -3);
     } else if (data.size() < block_size_) {
         std::vector<uint8_t> padding(block_size_ - data.size(), 0);
         data.insert(data.end(), padding.begin(), padding.end());
     }
 
     if (data.size() > block_size_) {
-        return Result<void>::err("Data size does not match block size", -3);
+        return Result<void>::err(ErrorKind::InvalidArgument, "Data size does not match block size", -3);
     }
 
     if (data.size() < block_size_) {
@@ -139,28 +149,83 @@ neonfs::Result<void> neonfs::storage::BlockStorage::writeBlock(uint64_t blockID,
         std::lock_guard<std::mutex> lock(file_stream_mutex);
         filestream.seekp(offset, std::ios::beg);
         if (!filestream.good()) {
-            return Result<void>::err("Failed to seek to block position", -4);
+            return Result<void>::err(ErrorKind::Io, "Failed to seek to block position", -4);
         }
 
         filestream.write(reinterpret_cast<const char*>(data.data()), block_size_);
         if (!filestream.good()) {
-            return Result<void>::err("Failed to write block: possible disk full", -5);
+            return Result<void>::err(ErrorKind::Io, "Failed to write block: possible disk full", -5);
         }
     }
 
     return Result<void>::ok();
 }
 
+neonfs::Result<void> neonfs::storage::BlockStorage::readBlockRange(const uint64_t blockID, const uint64_t offset, const std::span<uint8_t> buffer) {
+    std::lock_guard<std::mutex> lock(file_stream_mutex);
+    if (!is_mounted) {
+        return Result<void>::err(ErrorKind::NotMounted, "Storage is not mounted", -1);
+    }
+
+    if (blockID >= getBlockCount()) {
+        return Result<void>::err(ErrorKind::OutOfRange, "Invalid block ID", -2);
+    }
+
+    if (offset > block_size_ || buffer.size() > block_size_ - offset) {
+        return Result<void>::err(ErrorKind::InvalidArgument, "Range extends past the block", -5);
+    }
+
+    filestream.seekg(blockID * block_size_ + offset, std::ios::beg);
+    if (!filestream.good()) {
+        return Result<void>::err(ErrorKind::Io, "Failed to seek to block position", -3);
+    }
+
+    filestream.read(reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+    if (filestream.gcount() != static_cast<std::streamsize>(buffer.size())) {
+        return Result<void>::err(ErrorKind::Io, "Incomplete range read", -4);
+    }
+
+    return Result<void>::ok();
+}
+
+neonfs::Result<void> neonfs::storage::BlockStorage::writeBlockRange(const uint64_t blockID, const uint64_t offset, const std::span<const uint8_t> data) {
+    std::lock_guard<std::mutex> lock(file_stream_mutex);
+    if (!is_mounted) {
+        return Result<void>::err(ErrorKind::NotMounted, "Storage is not mounted", -1);
+    }
+
+    if (blockID >= getBlockCount()) {
+        return Result<void>::err(ErrorKind::OutOfRange, "Invalid block ID", -2);
+    }
+
+    if (offset > block_size_ || data.size() > block_size_ - offset) {
+        return Result<void>::err(ErrorKind::InvalidArgument, "Range extends past the block", -3);
+    }
+
+    // Only the range is written; the rest of the block may belong to someone else
+    filestream.seekp(blockID * block_size_ + offset, std::ios::beg);
+    if (!filestream.good()) {
+        return Result<void>::err(ErrorKind::Io, "Failed to seek to block position", -4);
+    }
+
+    filestream.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+    if (!filestream.good()) {
+        return Result<void>::err(ErrorKind::Io, "Failed to write block range: possible disk full", -5);
+    }
+
+    return Result<void>::ok();
+}
+
 neonfs::Result<void> neonfs::storage::BlockStorage::flush() {
     std::lock_guard<std::mutex> lock(file_stream_mutex);
 
     if (!is_mounted) {
-        return Result<void>::err("Storage is not mounted", -1);
+        return Result<void>::err(ErrorKind::NotMounted, "Storage is not mounted", -1);
     }
 
     filestream.flush();
     if (!filestream) {
-        return Result<void>::err("Flush failed");
+        return Result<void>::err(ErrorKind::Io, "Flush failed");
     }
 
     return Result<void>::ok();
@@ -0,0 +1,92 @@
+#include <NeonFS/storage/tail_packer.h>
+#include <iterator>
+#include <optional>
+
+neonfs::storage::TailPacker::TailPacker(BlockAllocator &allocator, const uint64_t blockSize)
+    : allocator(allocator), blockSize(blockSize) {}
+
+neonfs::Result<neonfs::storage::Extent> neonfs::storage::TailPacker::allocate(const uint32_t length) {
+    if (length == 0 || length > blockSize) {
+        return Result<Extent>::err(ErrorKind::InvalidArgument, "Extent length must be between 1 and the block size");
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto& [blockId, pack] : packs) {
+        if (pack.freeBytes < length) continue;
+
+        // First gap that fits, up to the next extent or the end of the block
+        std::optional<uint32_t> found;
+        uint32_t gapStart = 0;
+        for (const auto& [offset, used] : pack.extents) {
+            if (offset - gapStart >= length) {
+                found = gapStart;
+                break;
+            }
+            gapStart = offset + used;
+        }
+        if (!found && blockSize - gapStart >= length) found = gapStart;
+        if (!found) continue;
+
+        const Extent extent{blockId, *found, length};
+        insert(pack, extent);
+        return Result<Extent>::ok(extent);
+    }
+
+    auto blockId = allocator.allocate();
+    if (blockId.is_err()) return Result<Extent>::err(blockId.unwrap_err());
+    Pack& pack = packs[blockId.unwrap()];
+    pack.freeBytes = blockSize;
+    const Extent extent{blockId.unwrap(), 0, length};
+    insert(pack, extent);
+    return Result<Extent>::ok(extent);
+}
+
+void neonfs::storage::TailPacker::release(const Extent &extent) {
+    std::lock_guard<std::mutex> lock(mutex);
+    const auto pack = packs.find(extent.blockId);
+    if (pack == packs.end()) return;
+    const auto it = pack->second.extents.find(extent.offset);
+    if (it == pack->second.extents.end() || it->second != extent.length) return;
+
+    pack->second.extents.erase(it);
+    pack->second.freeBytes += extent.length;
+    usedBytes -= extent.length;
+    if (pack->second.extents.empty()) {
+        packs.erase(pack);
+        allocator.release(extent.blockId);
+    }
+}
+
+bool neonfs::storage::TailPacker::mark_used(const Extent &extent) {
+    if (extent.length == 0 || extent.offset > blockSize || extent.length > blockSize - extent.offset) return false;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto pack = packs.find(extent.blockId);
+    if (pack == packs.end()) {
+        if (!allocator.mark_used(extent.blockId)) return false;
+        pack = packs.emplace(extent.blockId, Pack{{}, blockSize}).first;
+    }
+    return insert(pack->second, extent);
+}
+
+uint64_t neonfs::storage::TailPacker::block_count() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return packs.size();
+}
+
+uint64_t neonfs::storage::TailPacker::used_bytes() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return usedBytes;
+}
+
+bool neonfs::storage::TailPacker::insert(Pack &pack, const Extent &extent) {
+    // Reject overlaps with the neighbours on either side
+    const auto next = pack.extents.lower_bound(extent.offset);
+    if (next != pack.extents.end() && next->first < extent.offset + extent.length) return false;
+    if (next != pack.extents.begin() && std::prev(next)->first + std::prev(next)->second > extent.offset) return false;
+
+    pack.extents.emplace_hint(next, extent.offset, extent.length);
+    pack.freeBytes -= extent.length;
+    usedBytes += extent.length;
+    return true;
+}
@@ -0,0 +1,66 @@
+#include <NeonFS/volume/file_handle.h>
+#include <NeonFS/volume/volume.h>
+
+neonfs::volume::FileHandle::FileHandle(Volume &volume, const uint64_t fileId) noexcept
+    : volume(&volume), fileId(fileId) {}
+
+uint64_t neonfs::volume::FileHandle::id() const noexcept {
+    return fileId;
+}
+
+neonfs::Result<size_t> neonfs::volume::FileHandle::read(const std::span<uint8_t> out) {
+    auto read = volume->pread(fileId, out, position);
+    if (read.is_ok()) position += read.unwrap();
+    return read;
+}
+
+neonfs::Result<size_t> neonfs::volume::FileHandle::write(const std::span<const uint8_t> data) {
+    auto written = volume->pwrite(fileId, data, position);
+    if (written.is_ok()) position += written.unwrap();
+    return written;
+}
+
+neonfs::Result<size_t> neonfs::volume::FileHandle::pread(const std::span<uint8_t> out, const uint64_t offset) const {
+    return volume->pread(fileId, out, offset);
+}
+
+neonfs::Result<size_t> neonfs::volume::FileHandle::pwrite(const std::span<const uint8_t> data, const uint64_t offset) const {
+    return volume->pwrite(fileId, data, offset);
+}
+
+neonfs::Result<uint64_t> neonfs::volume::FileHandle::seek(const int64_t offset, const SeekOrigin origin) {
+    uint64_t base = 0;
+    if (origin == SeekOrigin::Current) {
+        base = position;
+    } else if (origin == SeekOrigin::End) {
+        auto size = volume->size(fileId);
+        if (size.is_err()) return size;
+        base = size.unwrap();
+    }
+
+    if (offset >= 0) {
+        position = base + static_cast<uint64_t>(offset);
+        return Result<uint64_t>::ok(position);
+    }
+    // Negated without overflow for INT64_MIN
+    const uint64_t back = static_cast<uint64_t>(-(offset + 1)) + 1;
+    if (back > base) return Result<uint64_t>::err(ErrorKind::InvalidArgument, "Seek before the start of the file");
+    position = base - back;
+    return Result<uint64_t>::ok(position);
+}
+
+uint64_t neonfs::volume::FileHandle::tell() const noexcept {
+    return position;
+}
+
+neonfs::Result<uint64_t> neonfs::volume::FileHandle::size() const {
+    return volume->size(fileId);
+}
+
+neonfs::Result<void> neonfs::volume::FileHandle::truncate(const uint64_t size) const {
+    return volume->truncate(fileId, size);
+}
+
+neonfs::Result<void> neonfs::volume::FileHandle::flush() const {
+    return volume->flush(fileId);
+}
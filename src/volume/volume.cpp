@@ -0,0 +1,544 @@
+#include <NeonFS/volume/volume.h>
+#include <NeonFS/security/block_crypto.h>
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+    uint64_t now_seconds() {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::seconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count());
+    }
+}
+
+neonfs::volume::Volume::Volume(IMetadataProvider &metadata, IStorageProvider &storage, FileLockTable &locks, VolumeConfig config)
+    : metadata(metadata), storage(storage), locks(locks), config(std::move(config)), writeKeyVersion(this->config.keyVersion) {
+    if (!this->config.resolveKey) throw std::invalid_argument("A volume needs a key resolver");
+    if (!valid_chunk(this->config.chunkBlocks)) throw std::invalid_argument("The volume's chunk size is out of range");
+}
+
+neonfs::volume::Volume::~Volume() {
+    (void)flush();
+}
+
+neonfs::Result<void> neonfs::volume::Volume::mount() {
+    if (allocator) return Result<void>::err(ErrorKind::InvalidArgument, "Volume is already mounted");
+
+    const uint64_t blockSize = storage.getBlockSize();
+    allocator.emplace(storage.getBlockCount());
+    packer.emplace(*allocator, blockSize);
+    const auto fail = [&](const std::string& message) {
+        packer.reset();
+        allocator.reset();
+        return Result<void>::err(message);
+    };
+
+    try {
+        for (const uint64_t fileId : metadata.listMetadataIds()) {
+            const Metadata meta = metadata.getMetadata(fileId);
+            for (const BlockInfo& block : meta.blocks) {
+                if (block.packed) {
+                    const auto length = static_cast<uint32_t>(security::block_cipher_length(meta, block, blockSize));
+                    if (packer->mark_used({block.blockId, block.packedOffset, length})) continue;
+                    return fail("Packed tail of file " + std::to_string(fileId) + " in block " + std::to_string(block.blockId) +
+                                " overlaps another tail or a block in use");
+                }
+                for (uint64_t blockId = block.blockId; blockId < block.blockId + block.blockCount; ++blockId) {
+                    if (allocator->mark_used(blockId)) continue;
+                    return fail("Block " + std::to_string(blockId) + " of file " + std::to_string(fileId) +
+                                " is out of range or used by another file");
+                }
+            }
+        }
+    } catch (const std::exception& e) {
+        return fail(std::string("Failed to read the metadata: ") + e.what());
+    }
+    return Result<void>::ok();
+}
+
+bool neonfs::volume::Volume::isMounted() const noexcept {
+    return allocator.has_value();
+}
+
+neonfs::Result<neonfs::volume::FileHandle> neonfs::volume::Volume::create(const std::string &name, const uint64_t parentId, const uint32_t permissions,
+                                                                          const uint32_t chunkBlocks) {
+    if (!allocator) return Result<FileHandle>::err(ErrorKind::NotMounted, "Volume is not mounted");
+    const uint32_t chunk = chunkBlocks == 0 ? config.chunkBlocks : chunkBlocks;
+    if (!valid_chunk(chunk)) return Result<FileHandle>::err(ErrorKind::InvalidArgument, "Chunk size is out of range");
+    try {
+        const uint64_t fileId = metadata.createFile(name, parentId, permissions);
+        if (chunk != 1) {
+            Metadata meta = metadata.getMetadata(fileId);
+            meta.chunkBlocks = chunk;
+            metadata.upsertMetadata(meta);
+        }
+        return Result<FileHandle>::ok(FileHandle(*this, fileId));
+    } catch (const std::exception& e) {
+        return Result<FileHandle>::err(Error(e.what(), 0, ErrorKind::InvalidArgument));
+    }
+}
+
+neonfs::Result<neonfs::volume::FileHandle> neonfs::volume::Volume::open(const uint64_t fileId) {
+    const auto lock = locks.lock_shared(fileId);
+    auto meta = load(fileId);
+    if (meta.is_err()) return Result<FileHandle>::err(meta.unwrap_err());
+    return Result<FileHandle>::ok(FileHandle(*this, fileId));
+}
+
+neonfs::Result<void> neonfs::volume::Volume::remove(const uint64_t fileId) {
+    const auto lock = locks.lock_exclusive(fileId);
+    auto meta = load(fileId);
+    if (meta.is_err()) return Result<void>::err(meta.unwrap_err());
+
+    drop_buffer(fileId);
+    metadata.deleteMetadata(fileId);
+    const uint64_t blockSize = storage.getBlockSize();
+    for (const BlockInfo& block : meta.unwrap().blocks) {
+        release_block(block, security::block_cipher_length(meta.unwrap(), block, blockSize));
+    }
+    return Result<void>::ok();
+}
+
+neonfs::Result<size_t> neonfs::volume::Volume::pread(const uint64_t fileId, const std::span<uint8_t> out, const uint64_t offset) {
+    const auto lock = locks.lock_shared(fileId);
+    auto loaded = load(fileId);
+    if (loaded.is_err()) return Result<size_t>::err(loaded.unwrap_err());
+    const Metadata& meta = loaded.unwrap();
+    const BufferedFile* buffer = find_buffer(fileId);
+    const uint64_t size = buffer ? std::max(meta.size, buffer->size) : meta.size;
+    if (offset >= size || out.empty()) return Result<size_t>::ok(0);
+
+    const uint64_t chunkSize = security::chunk_size(meta, storage.getBlockSize());
+    const size_t count = static_cast<size_t>(std::min<uint64_t>(out.size(), size - offset));
+    const size_t stored = offset < meta.size ? static_cast<size_t>(std::min<uint64_t>(count, meta.size - offset)) : 0;
+    for (size_t done = 0; done < stored;) {
+        const uint64_t position = offset + done;
+        auto plain = read_plain(meta, static_cast<size_t>(position / chunkSize));
+        if (plain.is_err()) return Result<size_t>::err(plain.unwrap_err());
+
+        const size_t within = static_cast<size_t>(position % chunkSize);
+        const size_t n = std::min(stored - done, plain.unwrap().size() - within);
+        std::copy_n(plain.unwrap().begin() + static_cast<ptrdiff_t>(within), n, out.begin() + static_cast<ptrdiff_t>(done));
+        done += n;
+    }
+    // Past the stored end: a gap up to buffered writes
+    std::fill(out.begin() + static_cast<ptrdiff_t>(stored), out.begin() + static_cast<ptrdiff_t>(count), uint8_t{0});
+
+    if (buffer) {
+        std::vector<Patch> patches;
+        buffered_patches(*buffer, chunkSize, 0, 0, offset + count, patches);
+        for (const Patch& patch : patches) {
+            const uint64_t from = std::max(patch.offset, offset);
+            const uint64_t to = patch.offset + patch.data.size();
+            if (from >= to) continue;
+            std::copy(patch.data.begin() + static_cast<ptrdiff_t>(from - patch.offset), patch.data.end(),
+                      out.begin() + static_cast<ptrdiff_t>(from - offset));
+        }
+    }
+    return Result<size_t>::ok(count);
+}
+
+neonfs::Result<size_t> neonfs::volume::Volume::pwrite(const uint64_t fileId, const std::span<const uint8_t> data, const uint64_t offset) {
+    if (offset > std::numeric_limits<uint64_t>::max() - data.size()) {
+        return Result<size_t>::err(ErrorKind::InvalidArgument, "Write extends past the largest file size");
+    }
+
+    const auto lock = locks.lock_exclusive(fileId);
+    auto loaded = load(fileId);
+    if (loaded.is_err()) return Result<size_t>::err(loaded.unwrap_err());
+    if (data.empty()) return Result<size_t>::ok(0);
+    if (buffer_write(fileId, loaded.unwrap(), data, offset)) return Result<size_t>::ok(data.size());
+
+    // Write through, together with whatever the file has buffered outside this write
+    const uint64_t end = offset + data.size();
+    Metadata& meta = loaded.unwrap();
+    uint64_t newSize = std::max(meta.size, end);
+    std::vector<Patch> patches;
+    const BufferedFile* buffer = find_buffer(fileId);
+    if (buffer) {
+        buffered_patches(*buffer, security::chunk_size(meta, storage.getBlockSize()), offset, end, buffer->size, patches);
+        newSize = std::max(newSize, buffer->size);
+    }
+    patches.push_back({offset, data});
+    std::sort(patches.begin(), patches.end(), [](const Patch& a, const Patch& b) { return a.offset < b.offset; });
+
+    if (auto written = rewrite(meta, newSize, patches); written.is_err()) return Result<size_t>::err(written.unwrap_err());
+    if (buffer) drop_buffer(fileId);
+    return Result<size_t>::ok(data.size());
+}
+
+neonfs::Result<void> neonfs::volume::Volume::truncate(const uint64_t fileId, const uint64_t size) {
+    const auto lock = locks.lock_exclusive(fileId);
+    auto loaded = load(fileId);
+    if (loaded.is_err()) return Result<void>::err(loaded.unwrap_err());
+
+    // Buffered writes below the new size are applied in the same pass; the rest are dropped
+    std::vector<Patch> patches;
+    const BufferedFile* buffer = find_buffer(fileId);
+    if (buffer) buffered_patches(*buffer, security::chunk_size(loaded.unwrap(), storage.getBlockSize()), 0, 0, size, patches);
+    if (loaded.unwrap().size == size && patches.empty()) {
+        if (buffer) drop_buffer(fileId);
+        return Result<void>::ok();
+    }
+
+    if (auto written = rewrite(loaded.unwrap(), size, patches); written.is_err()) return written;
+    if (buffer) drop_buffer(fileId);
+    return Result<void>::ok();
+}
+
+neonfs::Result<uint64_t> neonfs::volume::Volume::size(const uint64_t fileId) {
+    const auto lock = locks.lock_shared(fileId);
+    auto meta = load(fileId);
+    if (meta.is_err()) return Result<uint64_t>::err(meta.unwrap_err());
+    const BufferedFile* buffer = find_buffer(fileId);
+    return Result<uint64_t>::ok(buffer ? std::max(meta.unwrap().size, buffer->size) : meta.unwrap().size);
+}
+
+neonfs::Result<void> neonfs::volume::Volume::flush(const uint64_t fileId) {
+    const auto lock = locks.lock_exclusive(fileId);
+    return flush_locked(fileId);
+}
+
+neonfs::Result<void> neonfs::volume::Volume::flush() {
+    std::vector<uint64_t> fileIds;
+    {
+        std::lock_guard<std::mutex> lock(buffersMutex);
+        for (const auto& [fileId, buffer] : buffers) fileIds.push_back(fileId);
+    }
+
+    std::optional<Error> failure;
+    for (const uint64_t fileId : fileIds) {
+        if (auto flushed = flush(fileId); flushed.is_err() && !failure) failure = flushed.unwrap_err();
+    }
+    if (failure) return Result<void>::err(*failure);
+    return Result<void>::ok();
+}
+
+bool neonfs::volume::Volume::valid_chunk(const uint32_t chunkBlocks) const {
+    return chunkBlocks >= 1 && chunkBlocks * storage.getBlockSize() <= max_chunk_size;
+}
+
+size_t neonfs::volume::Volume::buffered_blocks() const noexcept {
+    return bufferedBlocks.load(std::memory_order_relaxed);
+}
+
+void neonfs::volume::Volume::set_key_version(const uint32_t keyVersion) noexcept {
+    writeKeyVersion.store(keyVersion, std::memory_order_relaxed);
+}
+
+uint32_t neonfs::volume::Volume::key_version() const noexcept {
+    return writeKeyVersion.load(std::memory_order_relaxed);
+}
+
+uint64_t neonfs::volume::Volume::free_blocks() const {
+    return allocator ? allocator->free_count() : 0;
+}
+
+uint64_t neonfs::volume::Volume::packed_blocks() const {
+    return packer ? packer->block_count() : 0;
+}
+
+neonfs::Result<neonfs::Metadata> neonfs::volume::Volume::load(const uint64_t fileId) {
+    if (!allocator) return Result<Metadata>::err(ErrorKind::NotMounted, "Volume is not mounted");
+    Metadata meta;
+    try {
+        meta = metadata.getMetadata(fileId);
+    } catch (const std::out_of_range&) {
+        return Result<Metadata>::err(ErrorKind::NotFound, "No such file");
+    }
+    if (meta.isDirectory) return Result<Metadata>::err(ErrorKind::InvalidArgument, "Is a directory");
+
+    if (!valid_chunk(meta.chunkBlocks)) {
+        return Result<Metadata>::err(ErrorKind::InvalidArgument, "File has an invalid chunk size");
+    }
+    const uint64_t chunkSize = security::chunk_size(meta, storage.getBlockSize());
+    if (meta.blocks.size() != (meta.size + chunkSize - 1) / chunkSize) {
+        return Result<Metadata>::err(ErrorKind::InvalidArgument, "File block count does not match its size");
+    }
+    return Result<Metadata>::ok(std::move(meta));
+}
+
+neonfs::Result<std::shared_ptr<neonfs::IEncryptionProvider>> neonfs::volume::Volume::provider(const uint32_t keyVersion) {
+    std::lock_guard<std::mutex> lock(providersMutex);
+    if (const auto it = providers.find(keyVersion); it != providers.end()) {
+        return Result<std::shared_ptr<IEncryptionProvider>>::ok(it->second);
+    }
+    auto resolved = config.resolveKey(keyVersion);
+    if (resolved.is_err()) return resolved;
+    if (!resolved.unwrap()) {
+        return Result<std::shared_ptr<IEncryptionProvider>>::err(ErrorKind::NotFound, "No key for version");
+    }
+    providers.emplace(keyVersion, resolved.unwrap());
+    return resolved;
+}
+
+neonfs::Result<neonfs::secure_bytes> neonfs::volume::Volume::read_plain(const Metadata &meta, const size_t index) {
+    const BlockInfo& block = meta.blocks[index];
+    auto cipher = security::read_block_cipher(storage, meta, block);
+    if (cipher.is_err()) return cipher;
+
+    auto key = provider(block.keyVersion);
+    if (key.is_err()) return Result<secure_bytes>::err(key.unwrap_err());
+    return security::decrypt_block(*key.unwrap(), block, cipher.unwrap());
+}
+
+neonfs::Result<void> neonfs::volume::Volume::rewrite(Metadata &meta, const uint64_t newSize, const std::span<const Patch> patches) {
+    const uint64_t blockSize = storage.getBlockSize();
+    const uint64_t chunkSize = security::chunk_size(meta, blockSize);
+
+    // Blocks to re-encrypt, as ranges of block indexes: those the patches touch, the grown range, whose
+    // first block is the old last block if that was partial, and a new partial last block, since a
+    // block's ciphertext length follows the file size
+    std::vector<std::pair<uint64_t, uint64_t>> spans;
+    const auto include = [&](const uint64_t from, const uint64_t to) {
+        if (from < to) spans.emplace_back(from / chunkSize, (to - 1) / chunkSize);
+    };
+    for (const Patch& patch : patches) include(patch.offset, patch.offset + patch.data.size());
+    if (newSize > meta.size) include(meta.size, newSize);
+    if (newSize < meta.size && newSize % chunkSize != 0) include(newSize - newSize % chunkSize, newSize);
+
+    // A file small enough lives inline in its metadata, so crossing the limit moves its only block
+    const bool inlined = newSize <= std::min<uint64_t>(config.inlineThreshold, chunkSize);
+    const bool wasInlined = !meta.blocks.empty() && meta.blocks[0].blockCount == 0;
+    if (inlined != wasInlined) include(0, std::min(newSize, meta.size));
+    std::sort(spans.begin(), spans.end());
+
+    const uint32_t version = writeKeyVersion.load(std::memory_order_relaxed);
+    auto key = provider(version);
+    if (key.is_err()) return Result<void>::err(key.unwrap_err());
+
+    Metadata updated = meta;
+    updated.size = newSize;
+    const size_t blockCount = static_cast<size_t>((newSize + chunkSize - 1) / chunkSize);
+    updated.blocks.resize(std::min(meta.blocks.size(), blockCount));
+
+    std::vector<bool> replaced(updated.blocks.size(), false);
+    std::vector<std::pair<BlockInfo, size_t>> stored;     // New blocks with their ciphertext lengths
+    const auto fail = [&](const Error& error) {
+        for (const auto& [block, length] : stored) release_block(block, length);
+        return Result<void>::err(error);
+    };
+
+    size_t firstPatch = 0;      // First patch that does not end before the current block
+    uint64_t nextIndex = 0;     // First block index not yet rewritten
+    for (const auto& [firstIndex, lastIndex] : spans) {
+        for (uint64_t index = std::max(firstIndex, nextIndex); index <= lastIndex; ++index) {
+            const uint64_t blockStart = index * chunkSize;
+            secure_bytes plain(static_cast<size_t>(std::min(chunkSize, newSize - blockStart)), 0);
+            const uint64_t blockEnd = blockStart + plain.size();
+            while (firstPatch < patches.size() && patches[firstPatch].offset + patches[firstPatch].data.size() <= blockStart) ++firstPatch;
+
+            // Keep the old bytes the patches do not cover; patches are disjoint, so covered bytes add up
+            if (index < meta.blocks.size()) {
+                const size_t keep = std::min(plain.size(), security::block_cipher_length(meta, meta.blocks[index], blockSize));
+                uint64_t covered = 0;
+                for (size_t p = firstPatch; p < patches.size() && patches[p].offset < blockStart + keep; ++p) {
+                    const uint64_t from = std::max(patches[p].offset, blockStart);
+                    const uint64_t to = std::min(patches[p].offset + patches[p].data.size(), blockStart + keep);
+                    if (from < to) covered += to - from;
+                }
+                if (covered < keep) {
+                    auto old = read_plain(meta, static_cast<size_t>(index));
+                    if (old.is_err()) return fail(old.unwrap_err());
+                    std::copy_n(old.unwrap().begin(), keep, plain.begin());
+                }
+            }
+
+            for (size_t p = firstPatch; p < patches.size() && patches[p].offset < blockEnd; ++p) {
+                const uint64_t from = std::max(patches[p].offset, blockStart);
+                const uint64_t to = std::min(patches[p].offset + patches[p].data.size(), blockEnd);
+                if (from >= to) continue;
+                std::copy(patches[p].data.begin() + static_cast<ptrdiff_t>(from - patches[p].offset),
+                          patches[p].data.begin() + static_cast<ptrdiff_t>(to - patches[p].offset),
+                          plain.begin() + static_cast<ptrdiff_t>(from - blockStart));
+            }
+
+            secure_bytes iv;
+            secure_bytes tag;
+            auto cipher = key.unwrap()->encrypt(plain, iv, tag);
+            if (cipher.is_err()) return fail(cipher.unwrap_err());
+
+            BlockInfo info{};
+            if (inlined) {
+                info.blockId = 0;
+                info.blockCount = 0;
+                info.inlineData.assign(cipher.unwrap().begin(), cipher.unwrap().end());
+            } else {
+                if (auto written = store(info, cipher.unwrap()); written.is_err()) return fail(written.unwrap_err());
+                stored.emplace_back(info, cipher.unwrap().size());
+            }
+            info.offset = blockStart;
+            info.iv.assign(iv.begin(), iv.end());
+            info.tag.assign(tag.begin(), tag.end());
+            info.keyVersion = version;
+            if (index < updated.blocks.size()) {
+                updated.blocks[static_cast<size_t>(index)] = std::move(info);
+                replaced[static_cast<size_t>(index)] = true;
+            } else {
+                updated.blocks.push_back(std::move(info));
+            }
+        }
+        nextIndex = std::max(nextIndex, lastIndex + 1);
+    }
+    updated.timestamp_modified = now_seconds();
+
+    try {
+        metadata.upsertMetadata(updated);
+    } catch (const std::exception& e) {
+        return fail(Error(std::string("Failed to update the metadata: ") + e.what(), 0, ErrorKind::Io));
+    }
+
+    // Committed: the replaced and truncated blocks are free
+    for (size_t index = 0; index < meta.blocks.size(); ++index) {
+        if (index >= replaced.size() || replaced[index]) {
+            release_block(meta.blocks[index], security::block_cipher_length(meta, meta.blocks[index], blockSize));
+        }
+    }
+    meta = std::move(updated);
+    return Result<void>::ok();
+}
+
+neonfs::Result<void> neonfs::volume::Volume::store(BlockInfo &block, const std::span<const uint8_t> cipher) {
+    const uint64_t blockSize = storage.getBlockSize();
+    if (cipher.size() < blockSize && cipher.size() <= config.packThreshold) {
+        auto extent = packer->allocate(static_cast<uint32_t>(cipher.size()));
+        if (extent.is_err()) return Result<void>::err(extent.unwrap_err());
+        block.blockId = extent.unwrap().blockId;
+        block.blockCount = 1;
+        block.packed = true;
+        block.packedOffset = extent.unwrap().offset;
+    } else {
+        const uint32_t storageBlocks = security::storage_blocks_for(cipher.size(), blockSize);
+        auto blockId = allocator->allocate(storageBlocks);
+        if (blockId.is_err()) return Result<void>::err(blockId.unwrap_err());
+        block.blockId = blockId.unwrap();
+        block.blockCount = storageBlocks;
+    }
+
+    // Other files' tails in the same pack block are written concurrently, under their own file locks
+    std::unique_lock<std::mutex> blockLock;
+    if (block.packed) blockLock = locks.lock_block(block.blockId);
+    if (auto written = security::write_block_cipher(storage, block, cipher); written.is_err()) {
+        release_block(block, cipher.size());
+        return written;
+    }
+    return Result<void>::ok();
+}
+
+void neonfs::volume::Volume::release_block(const BlockInfo &block, const size_t cipherLength) {
+    if (block.blockCount == 0) return;
+    if (block.packed) packer->release({block.blockId, block.packedOffset, static_cast<uint32_t>(cipherLength)});
+    else allocator->release(block.blockId, block.blockCount);
+}
+
+void neonfs::volume::Volume::buffered_patches(const BufferedFile &buffer, const uint64_t chunkSize, const uint64_t skipFrom,
+                                              const uint64_t skipTo, const uint64_t limit, std::vector<Patch> &out) {
+    for (const auto& [index, block] : buffer.blocks) {
+        const uint64_t blockStart = index * chunkSize;
+        if (blockStart >= limit) break;
+        for (const auto& [rangeFrom, rangeTo] : block.ranges) {
+            const uint64_t from = blockStart + rangeFrom;
+            const uint64_t to = std::min(blockStart + rangeTo, limit);
+            const auto piece = [&](const uint64_t pieceFrom, const uint64_t pieceTo) {
+                if (pieceFrom >= pieceTo) return;
+                out.push_back({pieceFrom, std::span<const uint8_t>(block.data).subspan(
+                    static_cast<size_t>(pieceFrom - blockStart), static_cast<size_t>(pieceTo - pieceFrom))});
+            };
+            piece(from, std::min(to, skipFrom));
+            piece(std::max(from, skipTo), to);
+        }
+    }
+}
+
+neonfs::volume::Volume::BufferedFile* neonfs::volume::Volume::find_buffer(const uint64_t fileId) {
+    std::lock_guard<std::mutex> lock(buffersMutex);
+    const auto it = buffers.find(fileId);
+    return it == buffers.end() ? nullptr : it->second.get();
+}
+
+void neonfs::volume::Volume::drop_buffer(const uint64_t fileId) {
+    std::lock_guard<std::mutex> lock(buffersMutex);
+    const auto it = buffers.find(fileId);
+    if (it == buffers.end()) return;
+    bufferedBlocks.fetch_sub(it->second->blocks.size() * it->second->chunkBlocks, std::memory_order_relaxed);
+    buffers.erase(it);
+}
+
+bool neonfs::volume::Volume::buffer_write(const uint64_t fileId, const Metadata &meta, const std::span<const uint8_t> data, const uint64_t offset) {
+    if (config.writeBufferBlocks == 0) return false;
+
+    // Only writes that cover no whole chunk would need a read-modify-write cycle
+    const uint64_t chunkSize = security::chunk_size(meta, storage.getBlockSize());
+    const uint32_t chunkBlocks = std::max<uint32_t>(meta.chunkBlocks, 1);
+    const uint64_t end = offset + data.size();
+    const uint64_t firstWhole = (offset + chunkSize - 1) / chunkSize * chunkSize;
+    if (firstWhole + chunkSize <= end) return false;
+
+    const uint64_t firstIndex = offset / chunkSize;
+    const uint64_t lastIndex = (end - 1) / chunkSize;
+
+    std::lock_guard<std::mutex> lock(buffersMutex);
+    auto& buffer = buffers[fileId];
+    size_t added = 0;
+    for (uint64_t index = firstIndex; index <= lastIndex; ++index) {
+        if (!buffer || !buffer->blocks.contains(index)) added += chunkBlocks;
+    }
+    if (bufferedBlocks.load(std::memory_order_relaxed) + added > config.writeBufferBlocks) {
+        if (!buffer) buffers.erase(fileId);
+        return false;
+    }
+
+    if (!buffer) {
+        buffer = std::make_unique<BufferedFile>();
+        buffer->size = meta.size;
+        buffer->chunkBlocks = chunkBlocks;
+    }
+    for (uint64_t index = firstIndex; index <= lastIndex; ++index) {
+        const uint64_t blockStart = index * chunkSize;
+        const auto from = static_cast<uint32_t>(std::max(offset, blockStart) - blockStart);
+        const auto to = static_cast<uint32_t>(std::min(end, blockStart + chunkSize) - blockStart);
+
+        BufferedBlock& block = buffer->blocks[index];
+        if (block.data.empty()) block.data.resize(static_cast<size_t>(chunkSize), 0);
+        std::copy(data.begin() + static_cast<ptrdiff_t>(blockStart + from - offset),
+                  data.begin() + static_cast<ptrdiff_t>(blockStart + to - offset),
+                  block.data.begin() + from);
+
+        // Merge [from, to) into the sorted, disjoint ranges
+        auto& ranges = block.ranges;
+        uint32_t mergedFrom = from;
+        uint32_t mergedTo = to;
+        auto it = std::lower_bound(ranges.begin(), ranges.end(), std::pair<uint32_t, uint32_t>{from, 0},
+                                   [](const auto& a, const auto& b) { return a.second < b.first; });
+        auto last = it;
+        while (last != ranges.end() && last->first <= to) {
+            mergedFrom = std::min(mergedFrom, last->first);
+            mergedTo = std::max(mergedTo, last->second);
+            ++last;
+        }
+        it = ranges.erase(it, last);
+        ranges.insert(it, {mergedFrom, mergedTo});
+    }
+    buffer->size = std::max(buffer->size, end);
+    bufferedBlocks.fetch_add(added, std::memory_order_relaxed);
+    return true;
+}
+
+neonfs::Result<void> neonfs::volume::Volume::flush_locked(const uint64_t fileId) {
+    const BufferedFile* buffer = find_buffer(fileId);
+    if (!buffer) return Result<void>::ok();
+
+    auto loaded = load(fileId);
+    if (loaded.is_err()) {
+        if (loaded.unwrap_err().kind() == ErrorKind::NotFound) drop_buffer(fileId);
+        return Result<void>::err(loaded.unwrap_err());
+    }
+
+    std::vector<Patch> patches;
+    Metadata& meta = loaded.unwrap();
+    buffered_patches(*buffer, security::chunk_size(meta, storage.getBlockSize()), 0, 0, buffer->size, patches);
+    if (auto written = rewrite(meta, std::max(meta.size, buffer->size), patches); written.is_err()) return written;
+    drop_buffer(fileId);
+    return Result<void>::ok();
+}
@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+#include <NeonFS/async/async_io.h>
+#include <NeonFS/async/sync_wait.hpp>
+#include <NeonFS/async/thread_pool.h>
+#include <NeonFS/async/when_all.hpp>
+#include <NeonFS/async/work_stealing_executor.h>
+#include <NeonFS/core/types.h>
+#include <NeonFS/security/aes_encryption_provider.h>
+#include <NeonFS/storage/block_storage.h>
+#include <filesystem>
+
+namespace fs = std::filesystem;
+using namespace neonfs;
+using namespace neonfs::async;
+
+int main(int argc, char** argv) {
+    initialize_secure_heap(64 * 1024 * 1024);
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+namespace {
+    constexpr size_t block_size = 4096;
+
+    struct SealedBlock {
+        secure_bytes iv;
+        secure_bytes tag;
+        size_t length = 0;
+    };
+
+    // Encrypts and stores one block
+    Task<Result<void>> seal(IExecutor& pool, IStorageProvider& storage, IEncryptionProvider& provider,
+                            const uint64_t blockId, secure_bytes plain, SealedBlock& sealed) {
+        sealed.length = plain.size();
+        const secure_bytes cipher = co_await propagate(encrypt(pool, provider, std::move(plain), sealed.iv, sealed.tag));
+        co_await propagate(write_block(pool, storage, blockId, std::vector<uint8_t>(cipher.begin(), cipher.end())));
+        co_return Result<void>::ok();
+    }
+
+    // Round-trips one block through the overloads without an executor and reports where it continued
+    Task<Result<bool>> round_trip_on_shared(IStorageProvider& storage, const uint64_t blockId, std::vector<uint8_t> data) {
+        co_await propagate(write_block(storage, blockId, data));
+        const std::vector<uint8_t> read = co_await propagate(read_block(storage, blockId));
+        const bool onShared = WorkStealingExecutor::shared().current_worker().has_value();
+        co_return Result<bool>::ok(onShared && read == data);
+    }
+
+    // Reads, decrypts and checks one block; any failure ends the pipeline with its error
+    Task<Result<secure_bytes>> open(IExecutor& pool, IStorageProvider& storage, IEncryptionProvider& provider,
+                                    const uint64_t blockId, const SealedBlock& sealed) {
+        const std::vector<uint8_t> raw = co_await propagate(read_block(pool, storage, blockId));
+        secure_bytes cipher(raw.begin(), raw.begin() + static_cast<ptrdiff_t>(sealed.length));
+        co_return co_await decrypt(pool, provider, std::move(cipher), sealed.iv, sealed.tag);
+    }
+}
+
+class AsyncIoTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // One file per test, so that ctest can run the tests of this suite in parallel
+        const std::string name = ::testing::UnitTest::GetInstance()->current_test_info()->name();
+        path = fs::temp_directory_path() / ("async_io_test_" + name + ".bin");
+        const BlockStorageConfig config{block_size, block_size * 64};
+        storage::BlockStorage::create(path.string(), config).unwrap();
+        storage.mount(path.string(), config).unwrap();
+    }
+
+    void TearDown() override {
+        (void)storage.unmount();
+        fs::remove(path);
+    }
+
+    fs::path path;
+    storage::BlockStorage storage;
+    security::AESEncryptionProvider provider{secure_bytes(32, 0x42), 4};
+    ThreadPool pool{3};
+};
+
+TEST_F(AsyncIoTest, ReadDecryptVerifyPipeline) {
+    constexpr size_t blocks = 32;
+    std::vector<SealedBlock> sealed(blocks);
+
+    std::vector<Task<Result<void>>> writes;
+    for (size_t i = 0; i < blocks; ++i) {
+        writes.push_back(seal(pool, storage, provider, i, secure_bytes(block_size - i, static_cast<uint8_t>(i)), sealed[i]));
+    }
+    for (const auto& written : sync_wait(when_all(std::move(writes)))) ASSERT_TRUE(written.is_ok());
+
+    std::vector<Task<Result<secure_bytes>>> reads;
+    for (size_t i = 0; i < blocks; ++i) reads.push_back(open(pool, storage, provider, i, sealed[i]));
+    const auto plains = sync_wait(when_all(std::move(reads)));
+
+    for (size_t i = 0; i < blocks; ++i) {
+        ASSERT_TRUE(plains[i].is_ok()) << plains[i].unwrap_err().message();
+        EXPECT_EQ(plains[i].unwrap(), secure_bytes(block_size - i, static_cast<uint8_t>(i)));
+    }
+}
+
+TEST_F(AsyncIoTest, FailuresPropagateThroughThePipeline) {
+    SealedBlock sealed;
+    ASSERT_TRUE(sync_wait(seal(pool, storage, provider, 0, secure_bytes(100, 0x01), sealed)).is_ok());
+
+    // Out-of-range block: the read fails and decryption never runs
+    const auto missing = sync_wait(open(pool, storage, provider, 1000, sealed));
+    EXPECT_EQ(missing.unwrap_err().kind(), ErrorKind::OutOfRange);
+
+    // Tampered tag: the read succeeds, decryption fails
+    sealed.tag[0] ^= 0xFF;
+    const auto tampered = sync_wait(open(pool, storage, provider, 0, sealed));
+    EXPECT_EQ(tampered.unwrap_err().kind(), ErrorKind::Authentication);
+}
+
+TEST_F(AsyncIoTest, OverloadsWithoutAnExecutorUseTheSharedOne) {
+    const auto result = sync_wait(round_trip_on_shared(storage, 3, std::vector<uint8_t>(block_size, 0x5A)));
+    ASSERT_TRUE(result.is_ok()) << result.unwrap_err().message();
+    EXPECT_TRUE(result.unwrap());
+}
@@ -0,0 +1,162 @@
+#include <gtest/gtest.h>
+#include <NeonFS/async/sync_wait.hpp>
+#include <NeonFS/async/thread_pool.h>
+#include <NeonFS/async/when_all.hpp>
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+using namespace neonfs;
+using namespace neonfs::async;
+
+namespace {
+    Task<int> answer() {
+        co_return 42;
+    }
+
+    Task<int> doubled() {
+        const int value = co_await answer();
+        co_return value * 2;
+    }
+
+    Task<Result<int>> parse(const std::string text) {
+        if (text.empty()) co_return Result<int>::err(ErrorKind::InvalidArgument, "empty");
+        co_return Result<int>::ok(static_cast<int>(text.size()));
+    }
+
+    Task<Result<std::string>> describe(const std::string text, int& reachedEnd) {
+        const int length = co_await propagate(parse(text));
+        const int checked = co_await (length > 3 ? Result<int>::err(ErrorKind::OutOfRange, "too long") : Result<int>::ok(length));
+        ++reachedEnd;
+        co_return Result<std::string>::ok("length " + std::to_string(checked));
+    }
+
+    // Propagation through two levels of nested tasks
+    Task<Result<size_t>> outer(const std::string text, int& reachedEnd) {
+        const std::string description = co_await propagate(describe(text, reachedEnd));
+        co_return Result<size_t>::ok(description.size());
+    }
+
+    Task<void> throws() {
+        throw std::runtime_error("boom");
+        co_return;
+    }
+
+    Task<std::thread::id> on(IExecutor& executor) {
+        co_await executor.schedule();
+        co_return std::this_thread::get_id();
+    }
+
+    Task<void> mark(bool& started) {
+        started = true;
+        co_return;
+    }
+
+    Task<int> deep(const int depth) {
+        if (depth == 0) co_return 0;
+        co_return 1 + co_await deep(depth - 1);
+    }
+}
+
+TEST(TaskTest, AwaitsNestedTasks) {
+    EXPECT_EQ(sync_wait(doubled()), 84);
+}
+
+TEST(TaskTest, TasksAreLazy) {
+    bool started = false;
+    auto lazy = mark(started);
+    EXPECT_FALSE(started);
+    sync_wait(std::move(lazy));
+    EXPECT_TRUE(started);
+}
+
+TEST(TaskTest, AwaitingAResultPropagatesItsError) {
+    int reachedEnd = 0;
+    EXPECT_EQ(sync_wait(describe("abc", reachedEnd)).unwrap(), "length 3");
+    EXPECT_EQ(reachedEnd, 1);
+
+    auto invalid = sync_wait(describe("", reachedEnd));
+    EXPECT_EQ(invalid.unwrap_err().kind(), ErrorKind::InvalidArgument);
+    auto tooLong = sync_wait(describe("abcdef", reachedEnd));
+    EXPECT_EQ(tooLong.unwrap_err().message(), "too long");
+    EXPECT_EQ(reachedEnd, 1);  // Neither failure ran past its co_await
+}
+
+TEST(TaskTest, ErrorsPropagateThroughSeveralLevels) {
+    int reachedEnd = 0;
+    EXPECT_EQ(sync_wait(outer("ab", reachedEnd)).unwrap(), std::string("length 2").size());
+    EXPECT_EQ(sync_wait(outer("", reachedEnd)).unwrap_err().message(), "empty");
+    EXPECT_EQ(reachedEnd, 1);
+}
+
+TEST(TaskTest, PlainAwaitReturnsTheResult) {
+    auto inspect = []() -> Task<bool> {
+        const Result<int> parsed = co_await parse("");
+        co_return parsed.is_err();
+    };
+    EXPECT_TRUE(sync_wait(inspect()));
+}
+
+TEST(TaskTest, ExceptionsReachTheAwaiter) {
+    EXPECT_THROW(sync_wait(throws()), std::runtime_error);
+}
+
+TEST(TaskTest, DeepChainsDoNotGrowTheStack) {
+    EXPECT_EQ(sync_wait(deep(100000)), 100000);
+}
+
+TEST(TaskTest, ScheduleMovesToTheExecutor) {
+    ThreadPool pool(2);
+    EXPECT_EQ(pool.thread_count(), 2u);
+    EXPECT_NE(sync_wait(on(pool)), std::this_thread::get_id());
+}
+
+TEST(TaskTest, WhenAllKeepsOrderAndRunsConcurrently) {
+    ThreadPool pool(4);
+    std::atomic<int> running{0};
+    std::atomic<int> peak{0};
+
+    auto work = [&](const int i) -> Task<int> {
+        co_await pool.schedule();
+        const int now = running.fetch_add(1) + 1;
+        int seen = peak.load();
+        while (now > seen && !peak.compare_exchange_weak(seen, now)) {}
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        running.fetch_sub(1);
+        co_return i * i;
+    };
+
+    std::vector<Task<int>> tasks;
+    for (int i = 0; i < 8; ++i) tasks.push_back(work(i));
+    const auto squares = sync_wait(when_all(std::move(tasks)));
+
+    ASSERT_EQ(squares.size(), 8u);
+    for (int i = 0; i < 8; ++i) EXPECT_EQ(squares[i], i * i);
+    EXPECT_GT(peak.load(), 1);
+}
+
+TEST(TaskTest, WhenAllOfNothingCompletes) {
+    EXPECT_TRUE(sync_wait(when_all(std::vector<Task<int>>{})).empty());
+}
+
+TEST(TaskTest, WhenAllOfVoidTasksRethrows) {
+    bool first = false;
+    bool second = false;
+    std::vector<Task<void>> tasks;
+    tasks.push_back(mark(first));
+    tasks.push_back(mark(second));
+    sync_wait(when_all(std::move(tasks)));
+    EXPECT_TRUE(first && second);
+
+    std::vector<Task<void>> failing;
+    failing.push_back(throws());
+    EXPECT_THROW(sync_wait(when_all(std::move(failing))), std::runtime_error);
+}
+
+TEST(TaskTest, ManyOperationsInFlightOnFewThreads) {
+    ThreadPool pool(2);
+    std::vector<Task<std::thread::id>> tasks;
+    for (int i = 0; i < 5000; ++i) tasks.push_back(on(pool));
+    EXPECT_EQ(sync_wait(when_all(std::move(tasks))).size(), 5000u);
+}
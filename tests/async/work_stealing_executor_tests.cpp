@@ -0,0 +1,157 @@
+#include <gtest/gtest.h>
+#include <NeonFS/async/async_io.h>
+#include <NeonFS/async/sync_wait.hpp>
+#include <NeonFS/async/when_all.hpp>
+#include <NeonFS/async/work_stealing_executor.h>
+#include <NeonFS/metadata/in_memory_metadata_provider.h>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <thread>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+using namespace neonfs;
+using namespace neonfs::async;
+
+namespace {
+    Task<size_t> square_on(IExecutor& executor, const size_t value) {
+        co_await executor.schedule();
+        co_return value * value;
+    }
+
+    Task<std::optional<size_t>> worker_of(WorkStealingExecutor& executor) {
+        co_await executor.schedule();
+        co_return executor.current_worker();
+    }
+
+    // Occupies one worker while it queues `count` children on its own deque, so only thieves can run them
+    Task<void> fan_out_from_busy_worker(WorkStealingExecutor& executor, const size_t count,
+                                        std::mutex& mutex, std::set<size_t>& ranOn) {
+        co_await executor.schedule();
+        const size_t owner = *executor.current_worker();
+
+        std::vector<Task<void>> children;
+        for (size_t i = 0; i < count; ++i) {
+            children.push_back([](WorkStealingExecutor& executor, std::mutex& mutex, std::set<size_t>& ranOn) -> Task<void> {
+                co_await executor.schedule();
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                std::lock_guard<std::mutex> lock(mutex);
+                ranOn.insert(*executor.current_worker());
+            }(executor, mutex, ranOn));
+        }
+        // when_all starts each child inline; every schedule() lands on the owner's deque
+        auto all = when_all(std::move(children));
+        EXPECT_EQ(executor.current_worker(), owner);
+        co_await all;
+    }
+
+    Task<void> mark_after(IExecutor& executor, std::atomic<int>& done) {
+        co_await executor.schedule();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        done.fetch_add(1);
+    }
+
+    // Starts `task` without anyone awaiting it; it finishes on whichever executor it schedules onto
+    void start_detached(Task<void>& task) {
+        auto awaiter = task.operator co_await();
+        awaiter.await_suspend(std::noop_coroutine()).resume();
+    }
+}
+
+TEST(WorkStealingExecutorTest, RunsEveryPostedTask) {
+    WorkStealingExecutor executor({.threads = 4});
+    EXPECT_EQ(executor.thread_count(), 4u);
+
+    std::vector<Task<size_t>> tasks;
+    for (size_t i = 0; i < 2000; ++i) tasks.push_back(square_on(executor, i));
+    const auto squares = sync_wait(when_all(std::move(tasks)));
+
+    ASSERT_EQ(squares.size(), 2000u);
+    for (size_t i = 0; i < squares.size(); ++i) EXPECT_EQ(squares[i], i * i);
+}
+
+TEST(WorkStealingExecutorTest, ReportsTheCurrentWorker) {
+    WorkStealingExecutor executor({.threads = 2});
+    EXPECT_FALSE(executor.current_worker().has_value());
+
+    const auto worker = sync_wait(worker_of(executor));
+    ASSERT_TRUE(worker.has_value());
+    EXPECT_LT(*worker, 2u);
+
+    // Another executor's workers are not this one's
+    WorkStealingExecutor other({.threads = 1});
+    EXPECT_EQ(sync_wait(worker_of(other)), std::optional<size_t>(0));
+    EXPECT_THROW((void)executor.node_of(2), std::out_of_range);
+}
+
+TEST(WorkStealingExecutorTest, IdleWorkersStealFromABusyOne) {
+    WorkStealingExecutor executor({.threads = 4});
+    std::mutex mutex;
+    std::set<size_t> ranOn;
+
+    sync_wait(fan_out_from_busy_worker(executor, 64, mutex, ranOn));
+
+    EXPECT_GT(executor.steals(), 0u);
+    EXPECT_GT(ranOn.size(), 1u);
+}
+
+TEST(WorkStealingExecutorTest, DestructorFinishesQueuedWork) {
+    std::atomic<int> done{0};
+    std::vector<Task<void>> tasks;
+    {
+        WorkStealingExecutor executor({.threads = 2});
+        for (int i = 0; i < 50; ++i) {
+            tasks.push_back(mark_after(executor, done));
+            start_detached(tasks.back());
+        }
+    }
+    EXPECT_EQ(done.load(), 50);
+}
+
+TEST(WorkStealingExecutorTest, PinsWorkersWhenAsked) {
+    WorkStealingExecutor executor({.threads = 2, .numaAware = true, .pinThreads = true});
+    for (size_t i = 0; i < executor.thread_count(); ++i) EXPECT_GE(executor.cpu_of(i), 0);
+
+#if defined(__linux__)
+    const auto pinned = sync_wait([](WorkStealingExecutor& executor) -> Task<std::pair<size_t, int>> {
+        co_await executor.schedule();
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        sched_getaffinity(0, sizeof(set), &set);
+        co_return std::pair<size_t, int>{*executor.current_worker(), CPU_COUNT(&set)};
+    }(executor));
+    EXPECT_EQ(pinned.second, 1);
+#endif
+
+    WorkStealingExecutor unpinned({.threads = 2, .numaAware = false});
+    EXPECT_EQ(unpinned.cpu_of(0), -1);
+    EXPECT_EQ(unpinned.node_of(1), 0);
+}
+
+TEST(WorkStealingExecutorTest, SharedInstanceServesMetadataBatches) {
+    WorkStealingExecutor& executor = WorkStealingExecutor::shared();
+    EXPECT_EQ(&executor, &WorkStealingExecutor::shared());
+    EXPECT_GE(executor.thread_count(), 1u);
+
+    metadata::InMemoryMetadataProvider provider;
+    provider.initialize();
+
+    std::vector<Task<Result<void>>> writes;
+    for (uint64_t id = 1; id <= 32; ++id) {
+        Metadata meta{};
+        meta.fileId = id;
+        meta.filename = "file" + std::to_string(id);
+        writes.push_back(upsert_metadata(executor, provider, std::move(meta)));
+    }
+    for (const auto& written : sync_wait(when_all(std::move(writes)))) EXPECT_TRUE(written.is_ok());
+
+    std::vector<Task<Result<Metadata>>> reads;
+    for (uint64_t id = 1; id <= 33; ++id) reads.push_back(get_metadata(executor, provider, id));
+    const auto found = sync_wait(when_all(std::move(reads)));
+    for (uint64_t id = 1; id <= 32; ++id) EXPECT_EQ(found[id - 1].unwrap().filename, "file" + std::to_string(id));
+    EXPECT_EQ(found[32].unwrap_err().kind(), ErrorKind::NotFound);
+}
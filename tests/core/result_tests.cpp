@@ -1,10 +1,44 @@
 #include <gtest/gtest.h>
 #include <NeonFS/core/result.hpp>
 #include <cassert>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <span>
 #include <string>
+#include <vector>
 
 using namespace neonfs;
 
+namespace {
+    // Counts allocations made by this thread while `counting` is set
+    thread_local bool counting = false;
+    thread_local size_t allocations = 0;
+
+    // Stands in for a block buffer and counts how often it is copied
+    struct Payload {
+        static inline int copies = 0;
+        std::vector<uint8_t> bytes;
+
+        explicit Payload(const size_t size) : bytes(size, 0xAB) {}
+        Payload(const Payload& other) : bytes(other.bytes) { ++copies; }
+        Payload(Payload&&) noexcept = default;
+        Payload& operator=(const Payload& other) { bytes = other.bytes; ++copies; return *this; }
+        Payload& operator=(Payload&&) noexcept = default;
+    };
+}
+
+// The replacements stay out of line: once GCC inlines one into a caller, it pairs malloc() or free()
+// with the other operator and warns (-Wmismatched-new-delete)
+[[gnu::noinline]] void* operator new(const size_t size) {
+    if (counting) ++allocations;
+    if (void* p = std::malloc(size == 0 ? 1 : size)) return p;
+    throw std::bad_alloc();
+}
+
+[[gnu::noinline]] void operator delete(void* p) noexcept { std::free(p); }
+[[gnu::noinline]] void operator delete(void* p, size_t) noexcept { std::free(p); }
+
 TEST(ResultTests, IntResultSuccess) {
     auto int_result = Result<int>::ok(42);
     EXPECT_TRUE(int_result.is_ok());
@@ -16,8 +50,8 @@ TEST(ResultTests, IntResultError) {
     auto int_error = Result<int>::err("Calculation failed", 1);
     EXPECT_TRUE(int_error.is_err());
     EXPECT_FALSE(int_error.is_ok());
-    EXPECT_EQ(int_error.unwrap_err().message, "Calculation failed");
-    EXPECT_EQ(int_error.unwrap_err().code, 1);
+    EXPECT_EQ(int_error.unwrap_err().message(), "Calculation failed");
+    EXPECT_EQ(int_error.unwrap_err().code(), 1);
 }
 
 TEST(ResultTests, VoidResultSuccess) {
@@ -32,7 +66,7 @@ TEST(ResultTests, VoidResultSuccess) {
 TEST(ResultTests, VoidResultError) {
     auto void_error = Result<void>::err("Operation failed");
     EXPECT_TRUE(void_error.is_err());
-    EXPECT_EQ(void_error.unwrap_err().message, "Operation failed");
+    EXPECT_EQ(void_error.unwrap_err().message(), "Operation failed");
 }
 TEST(ResultTests, UnwrapVariantsSuccess) {
     auto ok_result = Result<std::string>::ok("success");
@@ -69,7 +103,7 @@ TEST(ResultTests, MapOperationsError) {
     auto mapped_err = Result<int>::err("original error")
         .map([](int x) { return x * 2; });
 
-    EXPECT_EQ(mapped_err.unwrap_err().message, "original error");
+    EXPECT_EQ(mapped_err.unwrap_err().message(), "original error");
 }
 
 TEST(ResultTests, AndThenSuccessChain) {
@@ -86,17 +120,17 @@ TEST(ResultTests, AndThenErrorPropagation) {
         .and_then([](int x) { return Result<int>::ok(x * 2); });
 
     EXPECT_TRUE(chained_err.is_err());
-    EXPECT_EQ(chained_err.unwrap_err().message, "chain failed");
+    EXPECT_EQ(chained_err.unwrap_err().message(), "chain failed");
 }
 
 TEST(ResultTests, MapErrTransformsError) {
     auto mapped_error = Result<int>::err("original", 1)
         .map_err([](const Error& err) {
-            return Error{err.message + " (mapped)", err.code + 1};
+            return Error{std::string(err.message()) + " (mapped)", err.code() + 1};
         });
 
-    EXPECT_EQ(mapped_error.unwrap_err().message, "original (mapped)");
-    EXPECT_EQ(mapped_error.unwrap_err().code, 2);
+    EXPECT_EQ(mapped_error.unwrap_err().message(), "original (mapped)");
+    EXPECT_EQ(mapped_error.unwrap_err().code(), 2);
 }
 
 TEST(ResultTests, OrElseRecoversFromError) {
@@ -110,25 +144,27 @@ TEST(ResultTests, VoidResultChaining) {
     auto void_ok = Result<void>::ok();
 
     // Chain producing Result<int> from void, then map returning void
-    void_ok.and_then([]() {
+    auto implicit = void_ok.and_then([]() {
         return Result<int>::ok(42);
     }).map([](int x) {
         EXPECT_EQ(x, 42);
         // Explicitly returning void
     });
+    EXPECT_TRUE(implicit.is_ok());
 
     // Explicit void return type in lambda
-    void_ok.and_then([]() {
+    auto explicit_void = void_ok.and_then([]() {
         return Result<int>::ok(42);
     }).map([](int x) -> void {
         EXPECT_EQ(x, 42);
     });
+    EXPECT_TRUE(explicit_void.is_ok());
 }
 
 TEST(ResultTests, VoidResultErrorRecovery) {
     auto void_err = Result<void>::err("void error")
         .or_else([](const Error& err) {
-            EXPECT_EQ(err.message, "void error");
+            EXPECT_EQ(err.message(), "void error");
             return Result<void>::ok();
         });
 
@@ -180,7 +216,7 @@ TEST(ResultTests, MatchWithError) {
     auto matched_err = Result<int>::err("error")
         .match(
             [](int) { return static_cast<size_t>(0); },
-            [](const Error& err) { return err.message.length(); }
+            [](const Error& err) { return err.message().length(); }
         );
     EXPECT_EQ(matched_err, 5);  // "error" length is 5
 }
@@ -194,4 +230,148 @@ TEST(ResultTests, VoidMatch) {
     );
 
     EXPECT_TRUE(success_called);
-}
\ No newline at end of file
+}
+TEST(ResultTests, StaticErrorsDoNotAllocate) {
+    counting = true;
+    allocations = 0;
+    {
+        auto literal = Result<std::vector<uint8_t>>::err("Incomplete block read", -4);
+        auto kind = Result<void>::err(ErrorKind::Io, "Failed to seek", -3);
+        auto bare = Result<int>::err(ErrorKind::Authentication);
+        const Error copy = literal.unwrap_err();
+        auto forwarded = Result<int>::err(kind.unwrap_err());
+        (void)copy.message();
+        (void)bare.unwrap_err().message();
+        (void)forwarded;
+    }
+    counting = false;
+    EXPECT_EQ(allocations, 0u);
+}
+
+TEST(ResultTests, ErrorKindAndMessage) {
+    const Error literal("disk full", 5);
+    EXPECT_EQ(literal.kind(), ErrorKind::Unknown);
+    EXPECT_EQ(literal.message(), "disk full");
+    EXPECT_EQ(literal.code(), 5);
+
+    const Error bare(ErrorKind::NotMounted);
+    EXPECT_EQ(bare.message(), "not mounted");
+    EXPECT_EQ(bare.describe(), "not mounted");
+
+    const Error context(ErrorKind::Io, "Flush failed", -1);
+    EXPECT_EQ(context.message(), "Flush failed");
+    EXPECT_EQ(context.describe(), "I/O error: Flush failed (code -1)");
+
+    const std::string formatted = "Unknown key version " + std::to_string(7);
+    const Error owned(formatted, 2, ErrorKind::NotFound);
+    const Error copy = owned;
+    EXPECT_EQ(copy.message(), formatted);
+    EXPECT_EQ(copy.message().data(), owned.message().data());  // Copies share the message
+    EXPECT_EQ(copy.kind(), ErrorKind::NotFound);
+}
+
+TEST(ResultTests, WritableBuffersAreCopied) {
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "Block %d failed", 7);
+    const auto error = Result<int>::err(buffer, 3);
+    std::snprintf(buffer, sizeof(buffer), "overwritten");
+    EXPECT_EQ(error.unwrap_err().message(), "Block 7 failed");
+    EXPECT_EQ(error.unwrap_err().code(), 3);
+
+    std::snprintf(buffer, sizeof(buffer), "Flush failed");
+    const Error owned(buffer);
+    buffer[0] = '\0';
+    EXPECT_EQ(owned.message(), "Flush failed");
+}
+
+TEST(ResultTests, RvalueChainsMoveThePayload) {
+    Payload::copies = 0;
+    auto size = Result<Payload>::ok(Payload(1 << 20))
+        .map([](Payload&& p) { p.bytes[0] = 1; return std::move(p); })
+        .and_then([](Payload&& p) { return Result<Payload>::ok(std::move(p)); })
+        .map_err([](Error e) { return e; })
+        .or_else([](const Error&) { return Result<Payload>::ok(Payload(1)); })
+        .map([](Payload p) { return p.bytes.size(); });
+    EXPECT_EQ(size.unwrap(), 1u << 20);
+
+    const Payload fallback = Result<Payload>::ok(Payload(16)).unwrap_or(Payload(1));
+    EXPECT_EQ(fallback.bytes.size(), 16u);
+    const auto optional = Result<Payload>::ok(Payload(16)).to_optional();
+    EXPECT_TRUE(optional.has_value());
+    EXPECT_EQ(Payload::copies, 0);
+}
+
+TEST(ResultTests, LvalueChainsLeaveTheSourceIntact) {
+    Payload::copies = 0;
+    auto source = Result<Payload>::ok(Payload(64));
+    auto size = source.map([](const Payload& p) { return p.bytes.size(); });
+    auto copied = source.map_err([](Error e) { return e; });
+
+    EXPECT_EQ(size.unwrap(), 64u);
+    EXPECT_EQ(source.unwrap().bytes.size(), 64u);
+    EXPECT_EQ(copied.unwrap().bytes.size(), 64u);
+    EXPECT_EQ(Payload::copies, 1);  // Only map_err on an lvalue copies
+}
+
+TEST(ResultTests, RvalueChainsMoveTheError) {
+    const std::string formatted = "block " + std::to_string(42) + " failed";
+    auto failed = Result<Payload>::err(formatted)
+        .map([](Payload&& p) { return std::move(p); })
+        .and_then([](Payload&& p) { return Result<Payload>::ok(std::move(p)); });
+    EXPECT_EQ(failed.unwrap_err().message(), formatted);
+}
+
+TEST(ResultTests, ReferenceResultBorrows) {
+    std::vector<int> block = {1, 2, 3};
+    auto borrowed = Result<std::vector<int>&>::ok(block);
+    ASSERT_TRUE(borrowed.is_ok());
+    EXPECT_EQ(&borrowed.unwrap(), &block);
+
+    borrowed.unwrap().push_back(4);
+    EXPECT_EQ(block.size(), 4u);
+
+    // Mapping to a member reference keeps borrowing
+    auto first = borrowed.map([](std::vector<int>& v) -> int& { return v.front(); });
+    first.unwrap() = 10;
+    EXPECT_EQ(block[0], 10);
+
+    auto size = borrowed.map([](const std::vector<int>& v) { return v.size(); });
+    EXPECT_EQ(size.unwrap(), 4u);
+
+    auto owned = borrowed.cloned();
+    owned.unwrap().clear();
+    EXPECT_EQ(block.size(), 4u);
+}
+
+TEST(ResultTests, ReferenceResultErrors) {
+    const std::string fallback = "fallback";
+    auto missing = Result<const std::string&>::err(ErrorKind::NotFound, "Block is not cached");
+    EXPECT_TRUE(missing.is_err());
+    EXPECT_THROW((void)missing.unwrap(), std::runtime_error);
+    EXPECT_EQ(missing.unwrap_err().kind(), ErrorKind::NotFound);
+    EXPECT_EQ(&missing.unwrap_or(fallback), &fallback);
+    EXPECT_FALSE(missing.to_optional().has_value());
+
+    auto recovered = missing.or_else([&](const Error&) { return Result<const std::string&>::ok(fallback); });
+    EXPECT_EQ(&recovered.unwrap(), &fallback);
+
+    auto length = missing.and_then([](const std::string& s) { return Result<size_t>::ok(s.size()); });
+    EXPECT_EQ(length.unwrap_err().message(), "Block is not cached");
+
+    const auto described = missing.match(
+        [](const std::string& s) { return s; },
+        [](const Error& e) { return std::string(e.message()); });
+    EXPECT_EQ(described, "Block is not cached");
+}
+
+TEST(ResultTests, SpanResultBorrowsABuffer) {
+    std::vector<uint8_t> buffer(64, 0x11);
+    auto view = Result<std::span<uint8_t>>::ok(std::span<uint8_t>(buffer).first(16));
+    auto sum = view.map([](const std::span<uint8_t> bytes) {
+        size_t total = 0;
+        for (const uint8_t b : bytes) total += b;
+        return total;
+    });
+    EXPECT_EQ(sum.unwrap(), 16u * 0x11);
+    EXPECT_EQ(view.unwrap().data(), buffer.data());
+}
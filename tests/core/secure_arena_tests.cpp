@@ -0,0 +1,98 @@
+#include <gtest/gtest.h>
+#include <NeonFS/core/secure_arena.h>
+#include <NeonFS/core/types.h>
+#include <algorithm>
+#include <memory_resource>
+
+using namespace neonfs;
+
+int main(int argc, char** argv) {
+    initialize_secure_heap(64 * 1024 * 1024);
+    ::testing::InitGoogleTest(&argc, argv);
+    const int result = RUN_ALL_TESTS();
+    cleanup_secure_heap();
+    return result;
+}
+
+TEST(SecureArenaTest, AllocationsComeFromTheSecureHeap) {
+    SecureArena arena;
+    arena_bytes iv(12, 0x01, secure_arena_allocator<uint8_t>(arena));
+    arena_bytes tag(16, 0x02, secure_arena_allocator<uint8_t>(arena));
+
+    EXPECT_TRUE(SecureHeap::owns(iv.data()));
+    EXPECT_TRUE(SecureHeap::owns(tag.data()));
+    EXPECT_EQ(arena.chunk_count(), 1u);
+    EXPECT_EQ(arena.used(), 28u);
+}
+
+TEST(SecureArenaTest, RespectsAlignment) {
+    SecureArena arena;
+    ASSERT_NE(arena.allocate(3, 1), nullptr);
+    void* p = arena.allocate(8, 64);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(p) % 64, 0u);
+
+    arena_vector<uint64_t> words(4, 7, secure_arena_allocator<uint64_t>(arena));
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(words.data()) % alignof(uint64_t), 0u);
+}
+
+TEST(SecureArenaTest, LastAllocationRollsBack) {
+    SecureArena arena;
+    void* first = arena.allocate(100, 1);
+    void* second = arena.allocate(50, 1);
+    EXPECT_EQ(arena.used(), 150u);
+
+    arena.deallocate(first, 100, 1);   // not on top, ignored
+    EXPECT_EQ(arena.used(), 150u);
+    arena.deallocate(second, 50, 1);
+    EXPECT_EQ(arena.used(), 100u);
+}
+
+TEST(SecureArenaTest, GrowsPastTheFirstChunk) {
+    SecureArena arena(1024);
+    arena_bytes block(4096, 0xAA, secure_arena_allocator<uint8_t>(arena));
+    EXPECT_EQ(arena.chunk_count(), 2u);
+    EXPECT_TRUE(std::all_of(block.begin(), block.end(), [](const uint8_t b) { return b == 0xAA; }));
+}
+
+TEST(SecureArenaTest, ResetWipesAndRewinds) {
+    SecureArena arena(256);
+    auto* secret = static_cast<uint8_t*>(arena.allocate(32, 1));
+    std::fill_n(secret, 32, 0x5A);
+    ASSERT_NE(arena.allocate(1024, 1), nullptr);
+    ASSERT_EQ(arena.chunk_count(), 2u);
+
+    arena.reset();
+    EXPECT_EQ(arena.chunk_count(), 1u);
+    EXPECT_EQ(arena.used(), 0u);
+    EXPECT_TRUE(std::all_of(secret, secret + 32, [](const uint8_t b) { return b == 0; }));
+
+    // The first chunk is reused
+    EXPECT_EQ(arena.allocate(32, 1), secret);
+}
+
+TEST(SecureArenaTest, WorksAsPolymorphicResource) {
+    SecureArena arena;
+    std::pmr::vector<uint8_t> buffer(&arena);
+    buffer.assign(64, 0x11);
+    EXPECT_TRUE(SecureHeap::owns(buffer.data()));
+    EXPECT_GE(arena.used(), 64u);
+}
+
+TEST(SecureArenaTest, AllocatorsCompareByArena) {
+    SecureArena a;
+    SecureArena b;
+    const secure_arena_allocator<uint8_t> first(a);
+    const secure_arena_allocator<uint32_t> rebound(first);
+    EXPECT_TRUE(first == rebound);
+    EXPECT_FALSE(first == secure_arena_allocator<uint8_t>(b));
+}
+
+TEST(SecureArenaTest, ReleasesEverythingOnDestruction) {
+    const size_t before = SecureHeap::used();
+    {
+        SecureArena arena(8192);
+        ASSERT_NE(arena.allocate(20000, 16), nullptr);
+        EXPECT_GT(SecureHeap::used(), before);
+    }
+    EXPECT_EQ(SecureHeap::used(), before);
+}
@@ -0,0 +1,135 @@
+#include <gtest/gtest.h>
+#include <NeonFS/core/secure_heap.h>
+#include <NeonFS/core/types.h>
+#include <algorithm>
+
+using namespace neonfs;
+
+namespace {
+    constexpr size_t region_size = 1024 * 1024;
+    constexpr size_t max_size = 64 * 1024 * 1024;
+    constexpr size_t bulk_size = 3 * 1024 * 1024;
+
+    SecureHeapConfig test_config() {
+        SecureHeapConfig config;
+        config.region_size = region_size;
+        config.max_size = max_size;
+        config.idle_regions = 1;
+        config.huge_page_threshold = 2 * 1024 * 1024;
+        return config;
+    }
+
+    size_t round_to_huge_pages(const size_t bytes) {
+        const size_t page = SecureHeap::huge_page_size();
+        return (bytes + page - 1) / page * page;
+    }
+}
+
+int main(int argc, char** argv) {
+    initialize_secure_heap(test_config());
+
+    ::testing::InitGoogleTest(&argc, argv);
+    const int result = RUN_ALL_TESTS();
+    cleanup_secure_heap();
+    return result;
+}
+
+class SecureHeapHugePageTest : public ::testing::Test {
+protected:
+    void TearDown() override {
+        SecureSlabPool::release();
+        SecureHeap::trim();
+    }
+};
+
+TEST_F(SecureHeapHugePageTest, HugePageSizeIsAPowerOfTwo) {
+    const size_t size = SecureHeap::huge_page_size();
+    EXPECT_GE(size, 64u * 1024);
+    EXPECT_EQ(size & (size - 1), 0u);
+}
+
+TEST_F(SecureHeapHugePageTest, BulkRequestsGetAlignedRegionsOfTheirOwn) {
+    const size_t regions = SecureHeap::region_count();
+    const size_t mapped = SecureHeap::mapped();
+
+    auto* p = static_cast<uint8_t*>(SecureHeap::allocate(bulk_size));
+    ASSERT_NE(p, nullptr);
+    EXPECT_TRUE(SecureHeap::owns(p));
+    EXPECT_TRUE(SecureHeap::owns(p + bulk_size - 1));
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(p) % SecureHeap::huge_page_size(), 0u);
+    EXPECT_TRUE(std::all_of(p, p + bulk_size, [](const uint8_t b) { return b == 0; }));
+    EXPECT_EQ(SecureHeap::region_count(), regions + 1);
+    EXPECT_EQ(SecureHeap::mapped(), mapped + round_to_huge_pages(bulk_size));
+    GTEST_LOG_(INFO) << "huge page regions: " << SecureHeap::huge_region_count();
+
+    SecureHeap::deallocate(p, bulk_size);
+}
+
+TEST_F(SecureHeapHugePageTest, SmallRequestsStayOutOfBulkRegions) {
+    SecureHeap::trim();
+    void* bulk = SecureHeap::allocate(bulk_size);
+    ASSERT_NE(bulk, nullptr);
+    const size_t mapped = SecureHeap::mapped();
+
+    // The bulk region has room to spare, but a regular region is mapped instead
+    void* small = SecureHeap::allocate(64 * 1024);
+    ASSERT_NE(small, nullptr);
+    EXPECT_EQ(SecureHeap::mapped(), mapped + region_size);
+    EXPECT_TRUE(static_cast<uint8_t*>(small) < static_cast<uint8_t*>(bulk) ||
+                static_cast<uint8_t*>(small) >= static_cast<uint8_t*>(bulk) + round_to_huge_pages(bulk_size));
+
+    SecureHeap::deallocate(small, 64 * 1024);
+    SecureHeap::deallocate(bulk, bulk_size);
+}
+
+TEST_F(SecureHeapHugePageTest, LargeSecureBytesUseHugePageRegions) {
+    secure_bytes plaintext(3 * 1024 * 1024, 0x5A);
+    EXPECT_TRUE(SecureHeap::owns(plaintext.data()));
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(plaintext.data()) % SecureHeap::huge_page_size(), 0u);
+}
+
+TEST_F(SecureHeapHugePageTest, EmptyBulkRegionsBeyondTheIdleLimitAreReleased) {
+    SecureHeap::trim();
+    void* a = SecureHeap::allocate(bulk_size);
+    void* b = SecureHeap::allocate(bulk_size);
+    ASSERT_TRUE(a && b);
+    EXPECT_EQ(SecureHeap::region_count(), 2u);
+
+    SecureHeap::deallocate(a, bulk_size);
+    SecureHeap::deallocate(b, bulk_size);
+
+    // One empty bulk region is kept, separately from the regular idle region
+    EXPECT_EQ(SecureHeap::region_count(), 1u);
+    EXPECT_EQ(SecureHeap::trim(), round_to_huge_pages(bulk_size));
+    EXPECT_EQ(SecureHeap::region_count(), 0u);
+}
+
+TEST_F(SecureHeapHugePageTest, ZeroThresholdDisablesBulkRegions) {
+    SecureSlabPool::release();
+    ASSERT_TRUE(SecureHeap::shutdown());
+    SecureHeapConfig config = test_config();
+    config.huge_page_threshold = 0;
+    config.region_size = 8 * 1024 * 1024;
+    SecureHeap::initialize(config);
+
+    // Served from the initial regular region
+    void* p = SecureHeap::allocate(bulk_size);
+    ASSERT_NE(p, nullptr);
+    EXPECT_EQ(SecureHeap::region_count(), 1u);
+    EXPECT_EQ(SecureHeap::huge_region_count(), 0u);
+    SecureHeap::deallocate(p, bulk_size);
+
+    ASSERT_TRUE(SecureHeap::shutdown());
+    SecureHeap::initialize(test_config());
+}
+
+#if !defined(_WIN32)
+TEST_F(SecureHeapHugePageTest, GuardPagesSurroundBulkRegions) {
+    GTEST_FLAG_SET(death_test_style, "threadsafe");
+    EXPECT_DEATH({
+        const size_t size = round_to_huge_pages(bulk_size);
+        auto* p = static_cast<volatile uint8_t*>(SecureHeap::allocate(size));
+        p[size] = 1;
+    }, "");
+}
+#endif
@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+#include <NeonFS/core/secure_arena.h>
+#include <NeonFS/core/secure_heap_stats.h>
+#include <NeonFS/core/types.h>
+#include <algorithm>
+#include <thread>
+
+using namespace neonfs;
+
+int main(int argc, char** argv) {
+    initialize_secure_heap(1024 * 1024);
+    ::testing::InitGoogleTest(&argc, argv);
+    const int result = RUN_ALL_TESTS();
+    cleanup_secure_heap();
+    return result;
+}
+
+namespace {
+    const SecureHeapTagStats* find_tag(const SecureHeapSnapshot& snap, const std::string& tag) {
+        const auto it = std::find_if(snap.tags.begin(), snap.tags.end(), [&](const SecureHeapTagStats& t) { return t.tag == tag; });
+        return it == snap.tags.end() ? nullptr : &*it;
+    }
+}
+
+TEST(SecureHeapStatsTest, ReportsHeapSize) {
+    EXPECT_EQ(SecureHeapStats::snapshot().heap_size, 1024u * 1024u);
+}
+
+TEST(SecureHeapStatsTest, CountsAllocationsAndBytesInUse) {
+    const auto before = SecureHeapStats::snapshot();
+    {
+        secure_bytes key(32);
+        secure_bytes block(4096);
+
+        const auto during = SecureHeapStats::snapshot();
+        EXPECT_EQ(during.allocations - before.allocations, 2u);
+        EXPECT_EQ(during.bytes_in_use - before.bytes_in_use, 32u + 4096u);
+        EXPECT_EQ(during.allocations_by_size[1] - before.allocations_by_size[1], 1u);  // 17..32 bytes
+        EXPECT_EQ(during.allocations_by_size[8] - before.allocations_by_size[8], 1u);  // 2049..4096 bytes
+        EXPECT_GT(during.heap_used, 0u);
+        EXPECT_GE(during.heap_peak, during.heap_used);
+        EXPECT_GT(during.slab_reserved, 0u);
+    }
+    const auto after = SecureHeapStats::snapshot();
+    EXPECT_EQ(after.deallocations - before.deallocations, 2u);
+    EXPECT_EQ(after.bytes_in_use, before.bytes_in_use);
+}
+
+TEST(SecureHeapStatsTest, BucketLimitsArePowersOfTwo) {
+    EXPECT_EQ(SecureHeapSnapshot::bucket_limit(0), 16u);
+    EXPECT_EQ(SecureHeapSnapshot::bucket_limit(8), 4096u);
+}
+
+TEST(SecureHeapStatsTest, CountsFailedAllocations) {
+    const auto before = SecureHeapStats::snapshot();
+    EXPECT_THROW(secure_bytes(2 * 1024 * 1024), std::bad_alloc);
+    EXPECT_EQ(SecureHeapStats::snapshot().failed_allocations - before.failed_allocations, 1u);
+}
+
+TEST(SecureHeapStatsTest, TracksPeakUsage) {
+    SecureHeapStats::reset_peak();
+    const size_t baseline = SecureHeapStats::snapshot().heap_peak;
+    {
+        secure_bytes large(256 * 1024);
+    }
+    const auto snap = SecureHeapStats::snapshot();
+    EXPECT_GE(snap.heap_peak, baseline + 256 * 1024);
+    EXPECT_LT(snap.heap_used, snap.heap_peak);
+}
+
+TEST(SecureHeapStatsTest, AttributesAllocationsToTags) {
+    const auto before = SecureHeapStats::snapshot();
+    const auto* tag_before = find_tag(before, "unit-test");
+    const uint64_t count_before = tag_before ? tag_before->allocations : 0;
+    {
+        SecureHeapTag tag("unit-test");
+        secure_bytes iv(12);
+        {
+            SecureHeapTag inner("unit-test-inner");
+            secure_bytes tag_bytes(16);
+        }
+        secure_bytes more(64);
+    }
+    secure_bytes untagged(8);
+
+    const auto after = SecureHeapStats::snapshot();
+    const auto* outer = find_tag(after, "unit-test");
+    const auto* inner = find_tag(after, "unit-test-inner");
+    ASSERT_NE(outer, nullptr);
+    ASSERT_NE(inner, nullptr);
+    EXPECT_EQ(outer->allocations - count_before, 2u);
+    EXPECT_EQ(inner->allocations, 1u);
+    EXPECT_EQ(inner->bytes_allocated, 16u);
+}
+
+TEST(SecureHeapStatsTest, KeepsCountsOfExitedThreads) {
+    const auto before = SecureHeapStats::snapshot();
+    std::thread worker([] {
+        SecureHeapTag tag("worker");
+        for (int i = 0; i < 10; ++i) secure_bytes buffer(100);
+        EXPECT_EQ(SecureHeapStats::thread_allocations(), 10u);
+    });
+    worker.join();
+
+    const auto after = SecureHeapStats::snapshot();
+    EXPECT_EQ(after.allocations - before.allocations, 10u);
+    ASSERT_NE(find_tag(after, "worker"), nullptr);
+    EXPECT_EQ(find_tag(after, "worker")->allocations, 10u);
+}
+
+TEST(SecureHeapStatsTest, IncludesArenaChunks) {
+    const auto before = SecureHeapStats::snapshot();
+    {
+        SecureArena arena(8192);
+        EXPECT_EQ(SecureHeapStats::snapshot().bytes_in_use - before.bytes_in_use, 8192u);
+    }
+    EXPECT_EQ(SecureHeapStats::snapshot().bytes_in_use, before.bytes_in_use);
+}
+
+TEST(SecureHeapStatsTest, FragmentationIsAShare) {
+    secure_bytes small(1);
+    const auto snap = SecureHeapStats::snapshot();
+    EXPECT_GT(snap.fragmentation, 0.0);
+    EXPECT_LE(snap.fragmentation, 1.0);
+}
@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+#include <NeonFS/core/secure_heap.h>
+#include <NeonFS/core/types.h>
+#include <algorithm>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+using namespace neonfs;
+
+namespace {
+    constexpr size_t region_size = 256 * 1024;
+    constexpr size_t max_size = 1024 * 1024;
+}
+
+int main(int argc, char** argv) {
+    SecureHeapConfig config;
+    config.region_size = region_size;
+    config.max_size = max_size;
+    config.idle_regions = 1;
+    initialize_secure_heap(config);
+
+    ::testing::InitGoogleTest(&argc, argv);
+    const int result = RUN_ALL_TESTS();
+    cleanup_secure_heap();
+    return result;
+}
+
+class SecureHeapTest : public ::testing::Test {
+protected:
+    void TearDown() override {
+        SecureSlabPool::release();
+        SecureHeap::trim();
+    }
+};
+
+TEST_F(SecureHeapTest, InitializeIsIdempotent) {
+    SecureHeapConfig other;
+    other.max_size = 4 * max_size;
+    SecureHeap::initialize(other);
+    EXPECT_EQ(SecureHeap::limit(), max_size);
+}
+
+TEST_F(SecureHeapTest, AllocationsAreZeroedAlignedAndOwned) {
+    auto* p = static_cast<uint8_t*>(SecureHeap::allocate(5000));
+    ASSERT_NE(p, nullptr);
+    EXPECT_TRUE(SecureHeap::owns(p));
+    EXPECT_TRUE(SecureHeap::owns(p + 4999));
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(p) % SecureHeap::granule, 0u);
+    EXPECT_TRUE(std::all_of(p, p + 5000, [](const uint8_t b) { return b == 0; }));
+    EXPECT_GE(SecureHeap::used(), 5000u);
+
+    int on_stack = 0;
+    EXPECT_FALSE(SecureHeap::owns(&on_stack));
+
+    SecureHeap::deallocate(p, 5000);
+}
+
+TEST_F(SecureHeapTest, FreedRangesCoalesce) {
+    const size_t before = SecureHeap::used();
+    void* a = SecureHeap::allocate(64 * 1024);
+    void* b = SecureHeap::allocate(64 * 1024);
+    void* c = SecureHeap::allocate(64 * 1024);
+    ASSERT_TRUE(a && b && c);
+
+    SecureHeap::deallocate(a, 64 * 1024);
+    SecureHeap::deallocate(c, 64 * 1024);
+    SecureHeap::deallocate(b, 64 * 1024);
+    EXPECT_EQ(SecureHeap::used(), before);
+
+    // Only possible if the three ranges merged back into one
+    void* whole = SecureHeap::allocate(192 * 1024);
+    ASSERT_NE(whole, nullptr);
+    EXPECT_EQ(SecureHeap::region_count(), 1u);
+    SecureHeap::deallocate(whole, 192 * 1024);
+}
+
+TEST_F(SecureHeapTest, GrowsUpToTheLimitAndReleasesIdleRegions) {
+    std::vector<void*> blocks;
+    for (size_t i = 0; i < max_size / region_size; ++i) {
+        void* p = SecureHeap::allocate(region_size);
+        ASSERT_NE(p, nullptr) << "region " << i;
+        blocks.push_back(p);
+    }
+    EXPECT_EQ(SecureHeap::region_count(), max_size / region_size);
+    EXPECT_EQ(SecureHeap::mapped(), max_size);
+
+    // The limit is reached
+    EXPECT_EQ(SecureHeap::allocate(64), nullptr);
+
+    for (void* p : blocks) SecureHeap::deallocate(p, region_size);
+
+    // One empty region is kept for reuse
+    EXPECT_EQ(SecureHeap::region_count(), 1u);
+    EXPECT_EQ(SecureHeap::trim(), region_size);
+    EXPECT_EQ(SecureHeap::region_count(), 0u);
+
+    // The heap grows again on demand
+    void* p = SecureHeap::allocate(100);
+    EXPECT_NE(p, nullptr);
+    SecureHeap::deallocate(p, 100);
+}
+
+TEST_F(SecureHeapTest, OversizedRequestsGetADedicatedRegion) {
+    void* p = SecureHeap::allocate(region_size + 1);
+    ASSERT_NE(p, nullptr);
+    EXPECT_GT(SecureHeap::mapped(), region_size);
+    SecureHeap::deallocate(p, region_size + 1);
+
+    EXPECT_EQ(SecureHeap::allocate(max_size + 1), nullptr);
+}
+
+TEST_F(SecureHeapTest, SecureBytesLargerThanTheOpenSSLHeapFit) {
+    // Twice the default OpenSSL secure heap set up by initialize_secure_heap
+    secure_bytes large(512 * 1024, 0x42);
+    EXPECT_TRUE(SecureHeap::owns(large.data()));
+}
+
+TEST_F(SecureHeapTest, ShutdownRefusesWhileInUse) {
+    void* p = SecureHeap::allocate(128);
+    ASSERT_NE(p, nullptr);
+    EXPECT_FALSE(SecureHeap::shutdown());
+    EXPECT_TRUE(SecureHeap::initialized());
+    SecureHeap::deallocate(p, 128);
+}
+
+TEST_F(SecureHeapTest, ConcurrentAllocation) {
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 8; ++t) {
+        threads.emplace_back([t] {
+            for (int i = 0; i < 500; ++i) {
+                const size_t size = 4096 + 64 * ((i + t) % 32);
+                auto* p = static_cast<uint8_t*>(SecureHeap::allocate(size));
+                ASSERT_NE(p, nullptr);
+                std::memset(p, t, size);
+                ASSERT_EQ(p[size - 1], static_cast<uint8_t>(t));
+                std::memset(p, 0, size);
+                SecureHeap::deallocate(p, size);
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+}
+
+#if !defined(_WIN32)
+TEST_F(SecureHeapTest, GuardPagesTrapOverruns) {
+    GTEST_FLAG_SET(death_test_style, "threadsafe");
+    EXPECT_DEATH({
+        auto* p = static_cast<volatile uint8_t*>(SecureHeap::allocate(region_size));
+        p[region_size] = 1;
+    }, "");
+}
+#endif
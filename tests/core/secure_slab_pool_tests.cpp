@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+#include <NeonFS/core/types.h>
+#include <NeonFS/core/secure_slab_pool.h>
+#include <algorithm>
+#include <cstring>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace neonfs;
+
+int main(int argc, char** argv) {
+    initialize_secure_heap(64 * 1024 * 1024);
+    ::testing::InitGoogleTest(&argc, argv);
+    const int result = RUN_ALL_TESTS();
+    cleanup_secure_heap();
+    return result;
+}
+
+TEST(SecureSlabPoolTest, SizeClassesCoverCommonCryptoSizes) {
+    EXPECT_EQ(SecureSlabPool::size_class(0), 0u);
+    EXPECT_EQ(SecureSlabPool::size_class(1), 16u);
+    EXPECT_EQ(SecureSlabPool::size_class(12), 16u);  // IV
+    EXPECT_EQ(SecureSlabPool::size_class(16), 16u);  // tag
+    EXPECT_EQ(SecureSlabPool::size_class(32), 32u);  // key
+    EXPECT_EQ(SecureSlabPool::size_class(33), 48u);
+    EXPECT_EQ(SecureSlabPool::size_class(4096), 4096u);
+    EXPECT_EQ(SecureSlabPool::size_class(4096 + 32), 4160u);
+    EXPECT_EQ(SecureSlabPool::size_class(SecureSlabPool::max_allocation + 1), 0u);
+}
+
+TEST(SecureSlabPoolTest, AllocationsAreDistinctAndSecure) {
+    std::vector<void*> blocks;
+    std::set<void*> unique;
+    for (int i = 0; i < 200; ++i) {
+        void* p = SecureSlabPool::allocate(32);
+        ASSERT_NE(p, nullptr);
+        EXPECT_TRUE(SecureHeap::owns(p));
+        std::memset(p, 0xAB, 32);
+        blocks.push_back(p);
+        unique.insert(p);
+    }
+    EXPECT_EQ(unique.size(), blocks.size());
+
+    for (void* p : blocks) SecureSlabPool::deallocate(p, 32);
+}
+
+TEST(SecureSlabPoolTest, FreedBlocksAreWiped) {
+    auto* p = static_cast<uint8_t*>(SecureSlabPool::allocate(100));
+    ASSERT_NE(p, nullptr);
+    std::memset(p, 0x5A, 100);
+    SecureSlabPool::deallocate(p, 100);
+
+    // The thread cache is LIFO, so the same block comes back
+    auto* again = static_cast<uint8_t*>(SecureSlabPool::allocate(100));
+    ASSERT_EQ(again, p);
+    EXPECT_TRUE(std::all_of(again, again + SecureSlabPool::size_class(100), [](const uint8_t b) { return b == 0; }));
+    SecureSlabPool::deallocate(again, 100);
+}
+
+TEST(SecureSlabPoolTest, BlocksCanBeFreedOnAnotherThread) {
+    std::vector<void*> blocks(500);
+    std::thread producer([&] {
+        for (auto& p : blocks) p = SecureSlabPool::allocate(4096);
+    });
+    producer.join();
+
+    for (void* p : blocks) {
+        ASSERT_NE(p, nullptr);
+        SecureSlabPool::deallocate(p, 4096);
+    }
+    EXPECT_TRUE(SecureSlabPool::release());
+}
+
+TEST(SecureSlabPoolTest, ReleaseRefusesWhileBlocksAreInUse) {
+    void* p = SecureSlabPool::allocate(64);
+    ASSERT_NE(p, nullptr);
+    EXPECT_FALSE(SecureSlabPool::release());
+    EXPECT_GT(SecureSlabPool::slab_count(), 0u);
+
+    SecureSlabPool::deallocate(p, 64);
+    EXPECT_TRUE(SecureSlabPool::release());
+    EXPECT_EQ(SecureSlabPool::slab_count(), 0u);
+}
+
+TEST(SecureSlabPoolTest, ConcurrentSecureBytesChurn) {
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 8; ++t) {
+        threads.emplace_back([t] {
+            for (int i = 0; i < 2000; ++i) {
+                secure_bytes iv(12, static_cast<uint8_t>(t));
+                secure_bytes block(4096 + (i % 64), static_cast<uint8_t>(i));
+                ASSERT_EQ(iv[11], static_cast<uint8_t>(t));
+                ASSERT_EQ(block.back(), static_cast<uint8_t>(i));
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+
+    // Exited threads returned their caches, so everything can be released
+    EXPECT_TRUE(SecureSlabPool::release());
+}
+
+TEST(SecureSlabPoolTest, LargeAllocationsBypassThePool) {
+    SecureSlabPool::release();
+    const size_t slabs = SecureSlabPool::slab_count();
+    {
+        secure_bytes large(SecureSlabPool::max_allocation + 1);
+        EXPECT_TRUE(SecureHeap::owns(large.data()));
+        EXPECT_EQ(SecureSlabPool::slab_count(), slabs);
+    }
+}
@@ -0,0 +1,54 @@
+#include <gtest/gtest.h>
+#include <NeonFS/core/token_bucket.h>
+#include <chrono>
+#include <stdexcept>
+
+using namespace neonfs;
+
+namespace {
+    double seconds_since(const std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+}
+
+TEST(TokenBucketTest, RejectsInvalidParameters) {
+    EXPECT_THROW(TokenBucket(-1, 10), std::invalid_argument);
+    EXPECT_THROW(TokenBucket(10, 0), std::invalid_argument);
+
+    TokenBucket bucket(10, 10);
+    EXPECT_THROW(bucket.set_rate(-1), std::invalid_argument);
+}
+
+TEST(TokenBucketTest, BurstIsAvailableImmediately) {
+    TokenBucket bucket(1, 5);
+    for (int i = 0; i < 5; ++i) EXPECT_TRUE(bucket.try_acquire(1));
+    EXPECT_FALSE(bucket.try_acquire(1));
+}
+
+TEST(TokenBucketTest, AcquirePacesToTheRate) {
+    TokenBucket bucket(100, 10);
+    const auto start = std::chrono::steady_clock::now();
+    // 10 from the burst, then 40 at 100 per second
+    for (int i = 0; i < 50; ++i) bucket.acquire(1);
+    EXPECT_GE(seconds_since(start), 0.35);
+}
+
+TEST(TokenBucketTest, RequestsLargerThanTheBurstWaitForTheDeficit) {
+    TokenBucket bucket(1000, 100);
+    const auto start = std::chrono::steady_clock::now();
+    bucket.acquire(300);
+    EXPECT_GE(seconds_since(start), 0.15);
+}
+
+TEST(TokenBucketTest, ZeroRateIsUnlimited) {
+    TokenBucket bucket(0, 1);
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < 1000; ++i) bucket.acquire(1000);
+    EXPECT_TRUE(bucket.try_acquire(1e9));
+    EXPECT_LT(seconds_since(start), 0.1);
+
+    bucket.set_rate(5);
+    EXPECT_EQ(bucket.rate(), 5);
+    EXPECT_TRUE(bucket.try_acquire(1));
+    EXPECT_FALSE(bucket.try_acquire(1));
+}
@@ -0,0 +1,69 @@
+#include <gtest/gtest.h>
+#include <NeonFS/metadata/in_memory_metadata_provider.h>
+#include <stdexcept>
+
+using namespace neonfs;
+using namespace neonfs::metadata;
+
+class InMemoryMetadataProviderTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        provider.initialize();
+    }
+
+    InMemoryMetadataProvider provider;
+};
+
+TEST_F(InMemoryMetadataProviderTest, RootExists) {
+    const Metadata root = provider.getMetadata(0);
+    EXPECT_TRUE(root.isDirectory);
+    EXPECT_TRUE(provider.isDirectoryEmpty(0));
+    EXPECT_THROW(provider.getMetadata(1), std::out_of_range);
+}
+
+TEST_F(InMemoryMetadataProviderTest, CreatesAndListsChildren) {
+    const uint64_t dir = provider.createDirectory("docs", 0, 0755);
+    const uint64_t file = provider.createFile("a.txt", dir, 0644);
+    EXPECT_NE(dir, file);
+
+    EXPECT_FALSE(provider.isDirectoryEmpty(dir));
+    const auto children = provider.getChildren(dir);
+    ASSERT_EQ(children.size(), 1u);
+    EXPECT_EQ(children[0].filename, "a.txt");
+    EXPECT_EQ(provider.listMetadataIds(), (std::vector<uint64_t>{0, dir, file}));
+
+    EXPECT_THROW(provider.createFile("b.txt", file, 0644), std::invalid_argument);
+}
+
+TEST_F(InMemoryMetadataProviderTest, UpsertRenameMoveDelete) {
+    const uint64_t dir = provider.createDirectory("docs", 0, 0755);
+    const uint64_t file = provider.createFile("a.txt", 0, 0644);
+
+    Metadata meta = provider.getMetadata(file);
+    meta.size = 10;
+    meta.blocks.push_back(BlockInfo{7, 0, {}, {}});
+    provider.upsertMetadata(meta);
+    EXPECT_EQ(provider.getMetadata(file).blocks.size(), 1u);
+
+    provider.rename(file, "b.txt");
+    provider.move(file, dir);
+    EXPECT_EQ(provider.getMetadata(file).filename, "b.txt");
+    EXPECT_EQ(provider.getMetadata(file).parentId, dir);
+    EXPECT_THROW(provider.move(dir, file), std::invalid_argument);
+
+    provider.deleteMetadata(file);
+    EXPECT_TRUE(provider.batchGetMetadata({file, dir}).size() == 1);
+}
+
+TEST_F(InMemoryMetadataProviderTest, VerifiesBlockLayout) {
+    Metadata meta = provider.getMetadata(provider.createFile("a", 0, 0644));
+    meta.size = 8192;
+    meta.blocks = {BlockInfo{1, 0, {}, {}}, BlockInfo{2, 4096, {}, {}}};
+    EXPECT_TRUE(provider.verifyMetadata(meta));
+
+    std::swap(meta.blocks[0], meta.blocks[1]);
+    EXPECT_FALSE(provider.verifyMetadata(meta));
+
+    meta.blocks = {BlockInfo{1, 8192, {}, {}}};
+    EXPECT_FALSE(provider.verifyMetadata(meta));
+}
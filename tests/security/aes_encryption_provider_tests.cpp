@@ -92,25 +92,25 @@ TEST_F(AESEncryptionProviderTest, EmptyPlaintext) {
 }
 
 TEST_F(AESEncryptionProviderTest, LargeData) {
-    std::cout << "before test scope heap usage: " << CRYPTO_secure_used() << "\n";
+    std::cout << "before test scope heap usage: " << SecureHeap::used() << "\n";
     {
-        std::cout << "begin of test scope Secure heap status:\n" << "  Used: " << CRYPTO_secure_used() << " bytes\n";
+        std::cout << "begin of test scope Secure heap status:\n" << "  Used: " << SecureHeap::used() << " bytes\n";
         secure_bytes largeData(5 * 1024 * 1024, 0x42); // 10MB of data
         secure_bytes iv, tag;
-        std::cout << "after alocating vars Secure heap status:\n" << "  Used: " << CRYPTO_secure_used() << " bytes\n";
+        std::cout << "after alocating vars Secure heap status:\n" << "  Used: " << SecureHeap::used() << " bytes\n";
 
         auto encryptResult = provider->encrypt(largeData, iv, tag);
-        std::cout << "after encrypt Secure heap status:\n" << "  Used: " << CRYPTO_secure_used() << " bytes\n";
+        std::cout << "after encrypt Secure heap status:\n" << "  Used: " << SecureHeap::used() << " bytes\n";
 
         ASSERT_TRUE(encryptResult.is_ok());
 
         auto decryptResult = provider->decrypt(encryptResult.unwrap(), iv, tag);
-        std::cout << "after decrypt Secure heap status:\n" << "  Used: " << CRYPTO_secure_used() << " bytes\n";
+        std::cout << "after decrypt Secure heap status:\n" << "  Used: " << SecureHeap::used() << " bytes\n";
         ASSERT_TRUE(decryptResult.is_ok());
         EXPECT_EQ(decryptResult.unwrap(), largeData);
-        std::cout << "end of test scope Secure heap status:\n" << "  Used: " << CRYPTO_secure_used() << " bytes\n";
+        std::cout << "end of test scope Secure heap status:\n" << "  Used: " << SecureHeap::used() << " bytes\n";
     }
-    std::cout << "after test scope heap usage: " << CRYPTO_secure_used() << "\n";
+    std::cout << "after test scope heap usage: " << SecureHeap::used() << "\n";
 }
 
 // Thread Safety
@@ -166,7 +166,7 @@ TEST_F(AESEncryptionProviderTest, ParallelLargeDataEncryption) {
     const size_t TOTAL_SIZE = 100 * 1024 * 1024; // 100MB
     const size_t CHUNK_SIZE = 512 * 1024;         // 512KB chunks
     const size_t NUM_THREADS = std::thread::hardware_concurrency();
-    size_t secureHeapPeak = CRYPTO_secure_used();
+    size_t secureHeapPeak = SecureHeap::used();
 
     // 1. Create source data (100MB)
     std::vector<uint8_t> sourceData(TOTAL_SIZE, 0x42);
@@ -199,7 +199,7 @@ TEST_F(AESEncryptionProviderTest, ParallelLargeDataEncryption) {
             // Store result (thread-safe)
             {
                 std::lock_guard<std::mutex> lock(encryptionMutex);
-                secureHeapPeak = CRYPTO_secure_used() > secureHeapPeak ? CRYPTO_secure_used() : secureHeapPeak;
+                secureHeapPeak = SecureHeap::used() > secureHeapPeak ? SecureHeap::used() : secureHeapPeak;
                 std::copy(cipher.begin(), cipher.end(),
                          encryptedData.begin() + offset);
             }
@@ -0,0 +1,176 @@
+#include <gtest/gtest.h>
+#include <NeonFS/security/data_key_manager.h>
+
+using namespace neonfs;
+using namespace neonfs::security;
+
+int main(int argc, char** argv) {
+    initialize_secure_heap(64 * 1024 * 1024);
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+namespace {
+    Metadata make_file(const uint64_t fileId) {
+        Metadata meta{};
+        meta.fileId = fileId;
+        meta.filename = "file-" + std::to_string(fileId);
+        return meta;
+    }
+
+    struct Sealed {
+        secure_bytes cipher;
+        secure_bytes iv;
+        secure_bytes tag;
+    };
+
+    Sealed seal(IEncryptionProvider& provider, const secure_bytes& plain) {
+        Sealed sealed;
+        auto cipher = provider.encrypt(plain, sealed.iv, sealed.tag);
+        EXPECT_TRUE(cipher.is_ok());
+        sealed.cipher = cipher.unwrap();
+        return sealed;
+    }
+}
+
+TEST(DataKeyManagerTest, WrapMatchesRFC3394) {
+    // RFC 3394 section 4.6: 256-bit key data with a 256-bit KEK
+    secure_bytes kek(32);
+    for (size_t i = 0; i < kek.size(); ++i) kek[i] = static_cast<uint8_t>(i);
+    const secure_bytes key = {0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0xFF,
+                              0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F};
+    const std::vector<uint8_t> expected = {0x28, 0xC9, 0xF4, 0x04, 0xC4, 0xB8, 0x10, 0xF4, 0xCB, 0xCC, 0xB3, 0x5C, 0xFB, 0x87, 0xF8, 0x26,
+                                           0x3F, 0x57, 0x86, 0xE2, 0xD8, 0x0E, 0xD3, 0x26, 0xCB, 0xC7, 0xF0, 0xE7, 0x1A, 0x99, 0xF4, 0x3B,
+                                           0xFB, 0x98, 0x8B, 0x9B, 0x7A, 0x02, 0xDD, 0x21};
+
+    auto wrapped = DataKeyManager::wrap_key(kek, key);
+    ASSERT_TRUE(wrapped.is_ok());
+    EXPECT_EQ(wrapped.unwrap(), expected);
+
+    auto unwrapped = DataKeyManager::unwrap_key(kek, expected);
+    ASSERT_TRUE(unwrapped.is_ok());
+    EXPECT_EQ(unwrapped.unwrap(), key);
+}
+
+TEST(DataKeyManagerTest, UnwrapRejectsWrongKeyAndCorruption) {
+    const secure_bytes kek(32, 0x01);
+    auto wrapped = DataKeyManager::wrap_key(kek, secure_bytes(32, 0x02));
+    ASSERT_TRUE(wrapped.is_ok());
+
+    EXPECT_TRUE(DataKeyManager::unwrap_key(secure_bytes(32, 0x03), wrapped.unwrap()).is_err());
+    auto corrupted = wrapped.unwrap();
+    corrupted[5] ^= 0x01;
+    EXPECT_TRUE(DataKeyManager::unwrap_key(kek, corrupted).is_err());
+}
+
+TEST(DataKeyManagerTest, FilesGetDistinctDataKeys) {
+    DataKeyManager manager(1, secure_bytes(32, 0x11));
+    Metadata a = make_file(1);
+    Metadata b = make_file(2);
+    ASSERT_TRUE(manager.assign_data_key(a).is_ok());
+    ASSERT_TRUE(manager.assign_data_key(b).is_ok());
+
+    EXPECT_EQ(a.wrappedKey.size(), DataKeyManager::wrapped_key_size);
+    EXPECT_EQ(a.wrappingKeyVersion, 1u);
+    EXPECT_NE(a.wrappedKey, b.wrappedKey);
+    EXPECT_TRUE(manager.assign_data_key(a).is_err());
+
+    // Data sealed under one file's key does not open under another's
+    auto providerA = manager.provider_for(a);
+    auto providerB = manager.provider_for(b);
+    ASSERT_TRUE(providerA.is_ok() && providerB.is_ok());
+    Sealed sealed = seal(*providerA.unwrap(), secure_bytes(4096, 0x5A));
+    EXPECT_TRUE(providerB.unwrap()->decrypt(sealed.cipher, sealed.iv, sealed.tag).is_err());
+    auto opened = providerA.unwrap()->decrypt(sealed.cipher, sealed.iv, sealed.tag);
+    ASSERT_TRUE(opened.is_ok());
+    EXPECT_EQ(opened.unwrap(), secure_bytes(4096, 0x5A));
+}
+
+TEST(DataKeyManagerTest, RotationRewrapsWithoutTouchingData) {
+    DataKeyManager manager(1, secure_bytes(32, 0x11));
+    Metadata meta = make_file(7);
+    ASSERT_TRUE(manager.assign_data_key(meta).is_ok());
+    auto before = manager.provider_for(meta);
+    ASSERT_TRUE(before.is_ok());
+    Sealed sealed = seal(*before.unwrap(), secure_bytes(1024, 0x42));
+
+    ASSERT_TRUE(manager.add_master_key(2, secure_bytes(32, 0x22)).is_ok());
+    ASSERT_TRUE(manager.set_current_version(2).is_ok());
+    const auto oldBlob = meta.wrappedKey;
+
+    auto changed = manager.rewrap(meta);
+    ASSERT_TRUE(changed.is_ok());
+    EXPECT_TRUE(changed.unwrap());
+    EXPECT_EQ(meta.wrappingKeyVersion, 2u);
+    EXPECT_NE(meta.wrappedKey, oldBlob);
+    EXPECT_FALSE(manager.rewrap(meta).unwrap());
+
+    // The old master key can go, and the block still decrypts with a freshly unwrapped key
+    ASSERT_TRUE(manager.retire_master_key(1).is_ok());
+    manager.clear_cache();
+    auto after = manager.provider_for(meta);
+    ASSERT_TRUE(after.is_ok());
+    auto opened = after.unwrap()->decrypt(sealed.cipher, sealed.iv, sealed.tag);
+    ASSERT_TRUE(opened.is_ok());
+    EXPECT_EQ(opened.unwrap(), secure_bytes(1024, 0x42));
+}
+
+TEST(DataKeyManagerTest, KeyringRules) {
+    DataKeyManager manager(1, secure_bytes(32, 0x11));
+    EXPECT_TRUE(manager.add_master_key(1, secure_bytes(32, 0x12)).is_err());
+    EXPECT_TRUE(manager.add_master_key(2, secure_bytes(16, 0x12)).is_err());
+    EXPECT_EQ(manager.set_current_version(9).unwrap_err().kind(), ErrorKind::NotFound);
+    EXPECT_TRUE(manager.retire_master_key(1).is_err());
+    EXPECT_EQ(manager.current_version(), 1u);
+
+    // Files wrapped under a retired version can no longer be opened
+    Metadata meta = make_file(3);
+    ASSERT_TRUE(manager.assign_data_key(meta).is_ok());
+    ASSERT_TRUE(manager.add_master_key(2, secure_bytes(32, 0x22)).is_ok());
+    ASSERT_TRUE(manager.set_current_version(2).is_ok());
+    ASSERT_TRUE(manager.retire_master_key(1).is_ok());
+    EXPECT_EQ(manager.provider_for(meta).unwrap_err().kind(), ErrorKind::NotFound);
+    EXPECT_EQ(manager.rewrap(meta).unwrap_err().kind(), ErrorKind::NotFound);
+
+    EXPECT_THROW(DataKeyManager(1, secure_bytes(31, 0)), std::invalid_argument);
+}
+
+TEST(DataKeyManagerTest, CacheIsBoundedAndReusesProviders) {
+    DataKeyManager manager(1, secure_bytes(32, 0x11), CipherSuite::AES_256_GCM, 2);
+    std::vector<Metadata> files;
+    for (uint64_t id = 1; id <= 3; ++id) {
+        files.push_back(make_file(id));
+        ASSERT_TRUE(manager.assign_data_key(files.back()).is_ok());
+    }
+
+    auto first = manager.provider_for(files[0]);
+    auto again = manager.provider_for(files[0]);
+    ASSERT_TRUE(first.is_ok() && again.is_ok());
+    EXPECT_EQ(first.unwrap().get(), again.unwrap().get());
+
+    ASSERT_TRUE(manager.provider_for(files[1]).is_ok());
+    ASSERT_TRUE(manager.provider_for(files[2]).is_ok());
+    EXPECT_EQ(manager.cached_count(), 2u);
+
+    // File 1 was least recently used and was evicted
+    auto reloaded = manager.provider_for(files[0]);
+    ASSERT_TRUE(reloaded.is_ok());
+    EXPECT_NE(reloaded.unwrap().get(), first.unwrap().get());
+
+    manager.evict(files[0].fileId);
+    EXPECT_EQ(manager.cached_count(), 1u);
+}
+
+TEST(DataKeyManagerTest, ReusedFileIdWithANewKeyIsNotServedFromCache) {
+    DataKeyManager manager(1, secure_bytes(32, 0x11));
+    Metadata original = make_file(5);
+    ASSERT_TRUE(manager.assign_data_key(original).is_ok());
+    auto oldProvider = manager.provider_for(original);
+    ASSERT_TRUE(oldProvider.is_ok());
+
+    Metadata recreated = make_file(5);
+    ASSERT_TRUE(manager.assign_data_key(recreated).is_ok());
+    auto newProvider = manager.provider_for(recreated);
+    ASSERT_TRUE(newProvider.is_ok());
+    EXPECT_NE(newProvider.unwrap().get(), oldProvider.unwrap().get());
+}
@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+#include <NeonFS/security/encryption_provider_factory.h>
+#include <openssl/rand.h>
+
+using namespace neonfs;
+using namespace neonfs::security;
+
+int main(int argc, char** argv) {
+    initialize_secure_heap(64 * 1024 * 1024);
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+static secure_bytes randomKey() {
+    secure_bytes key(32);
+    RAND_bytes(key.data(), key.size());
+    return key;
+}
+
+TEST(EncryptionProviderFactoryTest, CreatesEverySupportedSuite) {
+    for (const auto suite : {CipherSuite::AES_256_GCM, CipherSuite::CHACHA20_POLY1305, CipherSuite::AES_256_GCM_SIV}) {
+        auto provider = EncryptionProviderFactory::create(suite, randomKey(), 2);
+        if (!EncryptionProviderFactory::is_supported(suite)) {
+            EXPECT_TRUE(provider.is_err()) << EncryptionProviderFactory::name(suite);
+            continue;
+        }
+        ASSERT_TRUE(provider.is_ok()) << EncryptionProviderFactory::name(suite);
+
+        const secure_bytes plain = {1, 2, 3, 4, 5};
+        secure_bytes iv, tag;
+        auto cipher = provider.unwrap()->encrypt(plain, iv, tag).unwrap();
+        EXPECT_EQ(provider.unwrap()->decrypt(cipher, iv, tag).unwrap(), plain);
+    }
+}
+
+TEST(EncryptionProviderFactoryTest, SuitesAreNotInterchangeable) {
+    const secure_bytes key = randomKey();
+    auto aes = EncryptionProviderFactory::create(CipherSuite::AES_256_GCM, secure_bytes(key), 1).unwrap_move();
+    auto chacha = EncryptionProviderFactory::create(CipherSuite::CHACHA20_POLY1305, secure_bytes(key), 1).unwrap_move();
+
+    const secure_bytes plain = {9, 8, 7};
+    secure_bytes iv, tag;
+    auto cipher = aes->encrypt(plain, iv, tag).unwrap();
+    EXPECT_TRUE(chacha->decrypt(cipher, iv, tag).is_err());
+}
+
+TEST(EncryptionProviderFactoryTest, RejectsInvalidKey) {
+    EXPECT_TRUE(EncryptionProviderFactory::create(CipherSuite::CHACHA20_POLY1305, secure_bytes(16), 1).is_err());
+}
+
+TEST(EncryptionProviderFactoryTest, SelectionFollowsHardwareAes) {
+    auto suite = EncryptionProviderFactory::select_cipher_suite(false);
+    ASSERT_TRUE(suite.is_ok());
+
+    if (const auto hardware_aes = EncryptionProviderFactory::has_hardware_aes()) {
+        EXPECT_EQ(suite.unwrap(), *hardware_aes ? CipherSuite::AES_256_GCM : CipherSuite::CHACHA20_POLY1305);
+    }
+}
+
+TEST(EncryptionProviderFactoryTest, MisuseResistantSelection) {
+    auto suite = EncryptionProviderFactory::select_cipher_suite(true);
+    if (EncryptionProviderFactory::is_supported(CipherSuite::AES_256_GCM_SIV)) {
+        EXPECT_EQ(suite.unwrap(), CipherSuite::AES_256_GCM_SIV);
+    } else {
+        EXPECT_TRUE(suite.is_err());
+    }
+}
+
+TEST(EncryptionProviderFactoryTest, CreateFastestReportsSuite) {
+    CipherSuite suite{};
+    auto provider = EncryptionProviderFactory::create_fastest(randomKey(), 2, false, suite);
+    ASSERT_TRUE(provider.is_ok());
+    EXPECT_EQ(suite, EncryptionProviderFactory::select_cipher_suite(false).unwrap());
+}
+
+TEST(EncryptionProviderFactoryTest, MeasureThroughput) {
+    auto throughput = EncryptionProviderFactory::measure_throughput(CipherSuite::CHACHA20_POLY1305, 4096, 5);
+    ASSERT_TRUE(throughput.is_ok());
+    EXPECT_GT(throughput.unwrap(), 0.0);
+    EXPECT_TRUE(EncryptionProviderFactory::measure_throughput(CipherSuite::AES_256_GCM, 0, 5).is_err());
+}
@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+#include <NeonFS/security/key_cache.h>
+#include <NeonFS/core/secure_heap.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace neonfs;
+using namespace neonfs::security;
+
+int main(int argc, char** argv) {
+    initialize_secure_heap(64 * 1024 * 1024);
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+TEST(KeyCacheTest, ReturnsCachedKeysByVolume) {
+    KeyCache cache(std::chrono::minutes(5));
+    cache.put("vol-a", secure_bytes(32, 0xAA));
+    cache.put("vol-b", secure_bytes(32, 0xBB));
+
+    auto a = cache.get("vol-a");
+    ASSERT_TRUE(a.has_value());
+    EXPECT_EQ(*a, secure_bytes(32, 0xAA));
+    EXPECT_TRUE(SecureHeap::owns(a->data()));
+    EXPECT_EQ(cache.get("vol-b"), secure_bytes(32, 0xBB));
+    EXPECT_FALSE(cache.get("vol-c").has_value());
+    EXPECT_EQ(cache.size(), 2u);
+}
+
+TEST(KeyCacheTest, EntriesExpireAfterTheTTL) {
+    KeyCache cache(std::chrono::milliseconds(20));
+    cache.put("vol", secure_bytes(32, 0x01));
+    EXPECT_TRUE(cache.get("vol").has_value());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(40));
+    EXPECT_FALSE(cache.get("vol").has_value());
+    EXPECT_EQ(cache.size(), 0u);
+}
+
+TEST(KeyCacheTest, PutReplacesAndEvictRemoves) {
+    KeyCache cache(std::chrono::minutes(5));
+    cache.put("vol", secure_bytes(32, 0x01));
+    cache.put("vol", secure_bytes(32, 0x02));
+    EXPECT_EQ(cache.get("vol"), secure_bytes(32, 0x02));
+    EXPECT_EQ(cache.size(), 1u);
+
+    EXPECT_TRUE(cache.evict("vol"));
+    EXPECT_FALSE(cache.evict("vol"));
+    EXPECT_FALSE(cache.get("vol").has_value());
+}
+
+TEST(KeyCacheTest, CapacityEvictsTheEntryExpiringFirst) {
+    KeyCache cache(std::chrono::minutes(5), 2);
+    cache.put("first", secure_bytes(16, 1));
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    cache.put("second", secure_bytes(16, 2));
+    cache.put("third", secure_bytes(16, 3));
+
+    EXPECT_EQ(cache.size(), 2u);
+    EXPECT_FALSE(cache.get("first").has_value());
+    EXPECT_TRUE(cache.get("second").has_value());
+    EXPECT_TRUE(cache.get("third").has_value());
+}
+
+TEST(KeyCacheTest, GetOrUnlockRunsTheDerivationOnlyOnAMiss) {
+    KeyCache cache(std::chrono::minutes(5));
+    int calls = 0;
+    auto unlock = [&calls] {
+        ++calls;
+        return Result<secure_bytes>::ok(secure_bytes(32, 0x42));
+    };
+
+    auto first = cache.get_or_unlock("vol", unlock);
+    auto second = cache.get_or_unlock("vol", unlock);
+    ASSERT_TRUE(first.is_ok());
+    ASSERT_TRUE(second.is_ok());
+    EXPECT_EQ(first.unwrap(), second.unwrap());
+    EXPECT_EQ(calls, 1);
+}
+
+TEST(KeyCacheTest, ConcurrentMissesShareOneUnlock) {
+    KeyCache cache(std::chrono::minutes(5));
+    std::atomic<int> calls{0};
+    auto unlock = [&calls] {
+        ++calls;
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        return Result<secure_bytes>::ok(secure_bytes(32, 0x42));
+    };
+
+    std::vector<std::thread> threads;
+    std::atomic<int> unlocked{0};
+    for (int i = 0; i < 8; ++i) {
+        threads.emplace_back([&] {
+            if (cache.get_or_unlock("vol", unlock).is_ok()) ++unlocked;
+        });
+    }
+    for (auto& thread : threads) thread.join();
+    EXPECT_EQ(unlocked.load(), 8);
+    EXPECT_EQ(calls.load(), 1);
+}
+
+TEST(KeyCacheTest, WaitersRetryAfterAFailedUnlock) {
+    KeyCache cache(std::chrono::minutes(5));
+    std::atomic<bool> started{false};
+    std::thread wrong([&] {
+        auto failed = cache.get_or_unlock("vol", [&started] {
+            started = true;
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            return Result<secure_bytes>::err("Wrong password");
+        });
+        EXPECT_TRUE(failed.is_err());
+    });
+    while (!started) std::this_thread::yield();
+
+    // Waits for the failing unlock, then runs its own
+    auto right = cache.get_or_unlock("vol", [] { return Result<secure_bytes>::ok(secure_bytes(32, 0x42)); });
+    wrong.join();
+    ASSERT_TRUE(right.is_ok());
+    EXPECT_EQ(right.unwrap(), secure_bytes(32, 0x42));
+}
+
+TEST(KeyCacheTest, FailedUnlocksAreNotCached) {
+    KeyCache cache(std::chrono::minutes(5));
+    auto failed = cache.get_or_unlock("vol", [] { return Result<secure_bytes>::err("Wrong password"); });
+    EXPECT_TRUE(failed.is_err());
+    EXPECT_EQ(cache.size(), 0u);
+}
+
+TEST(KeyCacheTest, ClearReleasesSecureMemory) {
+    const size_t before = SecureHeap::used();
+    {
+        KeyCache cache(std::chrono::minutes(5));
+        for (int i = 0; i < 8; ++i) cache.put("vol-" + std::to_string(i), secure_bytes(8192, 0x5A));
+        EXPECT_GT(SecureHeap::used(), before);
+        cache.clear();
+        EXPECT_EQ(cache.size(), 0u);
+    }
+    EXPECT_EQ(SecureHeap::used(), before);
+}
+
+TEST(KeyCacheTest, RejectsInvalidConfiguration) {
+    EXPECT_THROW(KeyCache(std::chrono::milliseconds(0)), std::invalid_argument);
+    EXPECT_THROW(KeyCache(std::chrono::minutes(1), 0), std::invalid_argument);
+}
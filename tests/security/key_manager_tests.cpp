@@ -0,0 +1,175 @@
+#include <gtest/gtest.h>
+#include <NeonFS/security/key_manager.h>
+
+using namespace neonfs;
+using namespace neonfs::security;
+
+int main(int argc, char** argv) {
+    initialize_secure_heap(64 * 1024 * 1024);
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+namespace {
+    secure_bytes bytes_of(const std::string& text) {
+        return {text.begin(), text.end()};
+    }
+
+    // Cheap enough for tests; production callers should calibrate
+    Argon2Params test_params() {
+        Argon2Params params;
+        params.memory_kib = 1024;
+        params.iterations = 2;
+        params.lanes = 2;
+        return params;
+    }
+}
+
+TEST(KeyManagerTest, PBKDF2MatchesKnownAnswer) {
+    // RFC 7914 section 11, PBKDF2-HMAC-SHA256 with P = "passwd", S = "salt", c = 1
+    auto key = KeyManager::derive_key(bytes_of("passwd"), bytes_of("salt"), 16, KeyDerivationAlgorithm::PBKDF2_HMAC_SHA256, 1);
+    ASSERT_TRUE(key.is_ok());
+    const secure_bytes expected = {0x55, 0xac, 0x04, 0x6e, 0x56, 0xe3, 0x08, 0x9f, 0xec, 0x16, 0x91, 0xc2, 0x25, 0x44, 0xb6, 0x05};
+    EXPECT_EQ(key.unwrap(), expected);
+}
+
+TEST(KeyManagerTest, PBKDF2EntryPointsRejectArgon2id) {
+    const auto password = bytes_of("correct horse");
+    const auto salt = bytes_of("0123456789abcdef");
+    EXPECT_TRUE(KeyManager::derive_key(password, salt, 32, KeyDerivationAlgorithm::ARGON2ID, 3).is_err());
+    EXPECT_TRUE(KeyManager::verify_password(password, salt, secure_bytes(32), 32, KeyDerivationAlgorithm::ARGON2ID, 3).is_err());
+}
+
+TEST(KeyManagerTest, Argon2idRejectsInvalidParameters) {
+    const auto password = bytes_of("correct horse");
+    const auto salt = bytes_of("0123456789abcdef");
+
+    Argon2Params params = test_params();
+    params.memory_kib = 8 * params.lanes - 1;
+    EXPECT_TRUE(KeyManager::derive_key(password, salt, 32, params).is_err());
+
+    params = test_params();
+    params.iterations = 0;
+    EXPECT_TRUE(KeyManager::derive_key(password, salt, 32, params).is_err());
+
+    EXPECT_TRUE(KeyManager::derive_key(password, bytes_of("short"), 32, test_params()).is_err());
+    EXPECT_TRUE(KeyManager::derive_key(password, salt, 3, test_params()).is_err());
+    EXPECT_TRUE(KeyManager::calibrate_argon2(std::chrono::milliseconds(0), 1024, 1).is_err());
+}
+
+TEST(KeyManagerTest, Argon2idDerivationIsDeterministicAndThreadIndependent) {
+    if (!KeyManager::argon2_available()) GTEST_SKIP() << "OpenSSL without Argon2id";
+    const auto password = bytes_of("correct horse");
+    const auto salt = bytes_of("0123456789abcdef");
+
+    Argon2Params single = test_params();
+    single.threads = 1;
+    auto first = KeyManager::derive_key(password, salt, 32, single);
+    auto second = KeyManager::derive_key(password, salt, 32, test_params());
+    ASSERT_TRUE(first.is_ok());
+    ASSERT_TRUE(second.is_ok());
+    EXPECT_EQ(first.unwrap(), second.unwrap());
+
+    Argon2Params more_memory = test_params();
+    more_memory.memory_kib *= 2;
+    auto other = KeyManager::derive_key(password, salt, 32, more_memory);
+    ASSERT_TRUE(other.is_ok());
+    EXPECT_NE(other.unwrap(), first.unwrap());
+}
+
+TEST(KeyManagerTest, Argon2idVerifiesPasswords) {
+    if (!KeyManager::argon2_available()) GTEST_SKIP() << "OpenSSL without Argon2id";
+    const auto salt = bytes_of("0123456789abcdef");
+    auto key = KeyManager::derive_key(bytes_of("correct horse"), salt, 32, test_params());
+    ASSERT_TRUE(key.is_ok());
+
+    auto good = KeyManager::verify_password(bytes_of("correct horse"), salt, key.unwrap(), 32, test_params());
+    auto bad = KeyManager::verify_password(bytes_of("battery staple"), salt, key.unwrap(), 32, test_params());
+    ASSERT_TRUE(good.is_ok());
+    ASSERT_TRUE(bad.is_ok());
+    EXPECT_TRUE(good.unwrap());
+    EXPECT_FALSE(bad.unwrap());
+}
+
+TEST(KeyManagerTest, Argon2idCalibrationFitsTheTarget) {
+    if (!KeyManager::argon2_available()) GTEST_SKIP() << "OpenSSL without Argon2id";
+    auto params = KeyManager::calibrate_argon2(std::chrono::milliseconds(50), 8 * 1024, 2);
+    ASSERT_TRUE(params.is_ok());
+    EXPECT_EQ(params.unwrap().lanes, 2u);
+    EXPECT_GE(params.unwrap().iterations, 1u);
+    EXPECT_GE(params.unwrap().memory_kib, 16u);
+    EXPECT_LE(params.unwrap().memory_kib, 8u * 1024);
+}
+
+TEST(KeyManagerTest, Argon2idUnavailableIsAnError) {
+    if (KeyManager::argon2_available()) GTEST_SKIP() << "OpenSSL with Argon2id";
+    auto key = KeyManager::derive_key(bytes_of("correct horse"), bytes_of("0123456789abcdef"), 32, test_params());
+    EXPECT_TRUE(key.is_err());
+}
+
+TEST(KeyManagerTest, SubkeysAreDeterministicAndSeparatedByLabelAndContext) {
+    const secure_bytes master(32, 0x0B);
+    const secure_bytes file1 = {0, 0, 0, 0, 0, 0, 0, 1};
+    const secure_bytes file2 = {0, 0, 0, 0, 0, 0, 0, 2};
+
+    auto a = KeyManager::derive_subkey(master, "neonfs/file", file1, 32);
+    auto again = KeyManager::derive_subkey(master, "neonfs/file", file1, 32);
+    auto other_file = KeyManager::derive_subkey(master, "neonfs/file", file2, 32);
+    auto other_label = KeyManager::derive_subkey(master, "neonfs/metadata", file1, 32);
+    ASSERT_TRUE(a.is_ok() && again.is_ok() && other_file.is_ok() && other_label.is_ok());
+
+    EXPECT_EQ(a.unwrap(), again.unwrap());
+    EXPECT_NE(a.unwrap(), other_file.unwrap());
+    EXPECT_NE(a.unwrap(), other_label.unwrap());
+    EXPECT_NE(a.unwrap(), master);
+
+    EXPECT_TRUE(KeyManager::derive_subkey(master, "", file1, 32).is_err());
+    EXPECT_TRUE(KeyManager::derive_subkey(master, "neonfs/file", file1, 0).is_err());
+    EXPECT_TRUE(KeyManager::derive_subkey(secure_bytes{}, "neonfs/file", file1, 32).is_err());
+}
+
+TEST(KeyManagerTest, VerifyAndDeriveReturnsTheKeyOnlyForTheRightPassword) {
+    const auto salt = bytes_of("0123456789abcdef");
+    auto key = KeyManager::derive_key(bytes_of("correct horse"), salt, 32, KeyDerivationAlgorithm::PBKDF2_HMAC_SHA256, 1000);
+    ASSERT_TRUE(key.is_ok());
+    auto verifier = KeyManager::make_verifier(key.unwrap());
+    ASSERT_TRUE(verifier.is_ok());
+    EXPECT_NE(verifier.unwrap(), key.unwrap());
+
+    auto good = KeyManager::verify_and_derive(bytes_of("correct horse"), salt, verifier.unwrap(), 32, KeyDerivationAlgorithm::PBKDF2_HMAC_SHA256, 1000);
+    ASSERT_TRUE(good.is_ok());
+    ASSERT_TRUE(good.unwrap().has_value());
+    EXPECT_EQ(*good.unwrap(), key.unwrap());
+
+    auto bad = KeyManager::verify_and_derive(bytes_of("battery staple"), salt, verifier.unwrap(), 32, KeyDerivationAlgorithm::PBKDF2_HMAC_SHA256, 1000);
+    ASSERT_TRUE(bad.is_ok());
+    EXPECT_FALSE(bad.unwrap().has_value());
+
+    EXPECT_TRUE(KeyManager::verify_and_derive(bytes_of("correct horse"), salt, secure_bytes(16), 32, KeyDerivationAlgorithm::PBKDF2_HMAC_SHA256, 1000).is_err());
+}
+
+TEST(KeyManagerTest, VerifyAndDeriveWithArgon2id) {
+    if (!KeyManager::argon2_available()) GTEST_SKIP() << "OpenSSL without Argon2id";
+    const auto salt = bytes_of("0123456789abcdef");
+    auto key = KeyManager::derive_key(bytes_of("correct horse"), salt, 32, test_params());
+    ASSERT_TRUE(key.is_ok());
+    auto verifier = KeyManager::make_verifier(key.unwrap());
+    ASSERT_TRUE(verifier.is_ok());
+
+    auto good = KeyManager::verify_and_derive(bytes_of("correct horse"), salt, verifier.unwrap(), 32, test_params());
+    ASSERT_TRUE(good.is_ok());
+    ASSERT_TRUE(good.unwrap().has_value());
+    EXPECT_EQ(*good.unwrap(), key.unwrap());
+}
+
+TEST(KeyManagerTest, PBKDF2CalibrationScalesWithTheTarget) {
+    auto shorter = KeyManager::calibrate_pbkdf2(std::chrono::milliseconds(10), KeyDerivationAlgorithm::PBKDF2_HMAC_SHA256);
+    auto longer = KeyManager::calibrate_pbkdf2(std::chrono::milliseconds(100), KeyDerivationAlgorithm::PBKDF2_HMAC_SHA256);
+    ASSERT_TRUE(shorter.is_ok());
+    ASSERT_TRUE(longer.is_ok());
+    EXPECT_GE(shorter.unwrap(), 1u);
+    EXPECT_GT(longer.unwrap(), shorter.unwrap());
+
+    EXPECT_TRUE(KeyManager::calibrate_pbkdf2(std::chrono::milliseconds(0), KeyDerivationAlgorithm::PBKDF2_HMAC_SHA512).is_err());
+    EXPECT_TRUE(KeyManager::calibrate_pbkdf2(std::chrono::milliseconds(10), KeyDerivationAlgorithm::ARGON2ID).is_err());
+}
@@ -0,0 +1,385 @@
+#include <gtest/gtest.h>
+#include <NeonFS/core/types.h>
+#include <NeonFS/metadata/in_memory_metadata_provider.h>
+#include <NeonFS/security/aes_encryption_provider.h>
+#include <NeonFS/security/reencryption_engine.h>
+#include <NeonFS/storage/block_storage.h>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <thread>
+
+namespace fs = std::filesystem;
+using namespace neonfs;
+using namespace neonfs::security;
+
+int main(int argc, char** argv) {
+    initialize_secure_heap(64 * 1024 * 1024);
+    ::testing::InitGoogleTest(&argc, argv);
+    const int result = RUN_ALL_TESTS();
+    cleanup_secure_heap();
+    return result;
+}
+
+namespace {
+    constexpr size_t block_size = 4096;
+
+    // Passes everything through to a real store, but can make the next write fail after landing fully or halfway
+    class FaultyStorage final : public IStorageProvider {
+    public:
+        enum class Fault { None, Torn, LostAcknowledgement };
+
+        explicit FaultyStorage(IStorageProvider& inner) : inner(inner) {}
+
+        Result<std::vector<uint8_t>> readBlock(const uint64_t blockID) override { return inner.readBlock(blockID); }
+
+        Result<void> writeBlock(const uint64_t blockID, std::vector<uint8_t>& data) override {
+            const Fault current = std::exchange(fault, Fault::None);
+            if (current == Fault::Torn) {
+                auto old = inner.readBlock(blockID).unwrap();
+                std::copy_n(data.begin(), data.size() / 2, old.begin());
+                (void)inner.writeBlock(blockID, old);
+                return Result<void>::err("Crashed mid-write");
+            }
+            auto written = inner.writeBlock(blockID, data);
+            if (current == Fault::LostAcknowledgement) return Result<void>::err("Crashed after the write");
+            return written;
+        }
+
+        [[nodiscard]] uint64_t getBlockCount() const override { return inner.getBlockCount(); }
+        [[nodiscard]] uint64_t getBlockSize() const override { return inner.getBlockSize(); }
+
+        Fault fault = Fault::None;
+
+    private:
+        IStorageProvider& inner;
+    };
+}
+
+class ReencryptionEngineTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // One file per test, so that ctest can run the tests of this suite in parallel
+        const std::string name = ::testing::UnitTest::GetInstance()->current_test_info()->name();
+        path = fs::temp_directory_path() / ("reencryption_engine_test_" + name + ".bin");
+        const BlockStorageConfig config{block_size, block_size * 256};
+        storage::BlockStorage::create(path.string(), config).unwrap();
+        storage.mount(path.string(), config).unwrap();
+        metadata.initialize();
+
+        keys[1] = secure_bytes(32, 0x11);
+        keys[2] = secure_bytes(32, 0x22);
+    }
+
+    void TearDown() override {
+        (void)storage.unmount();
+        fs::remove(path);
+    }
+
+    Result<std::shared_ptr<IEncryptionProvider>> resolve(const uint32_t version) {
+        const auto it = keys.find(version);
+        if (it == keys.end()) return Result<std::shared_ptr<IEncryptionProvider>>::err("Unknown key version");
+        secure_bytes key = it->second;
+        return Result<std::shared_ptr<IEncryptionProvider>>::ok(
+            std::make_shared<AESEncryptionProvider>(std::move(key), 2, IVSequence::create(version)));
+    }
+
+    ReencryptionConfig config_for(const uint32_t targetVersion) {
+        ReencryptionConfig config;
+        config.targetVersion = targetVersion;
+        config.resolveKey = [this](const uint32_t version) { return resolve(version); };
+        config.onCheckpoint = [this](const ReencryptionCheckpoint& checkpoint) {
+            std::lock_guard<std::mutex> lock(checkpointMutex);
+            saved = checkpoint;
+            return Result<void>::ok();
+        };
+        return config;
+    }
+
+    // Writes `size` bytes of a pattern under key version 1; with `generations` the blocks store IV counters instead of IVs
+    uint64_t write_file(const std::string& name, const size_t size, const bool generations = false) {
+        const uint64_t fileId = metadata.createFile(name, 0, 0644);
+        Metadata meta = metadata.getMetadata(fileId);
+        meta.size = size;
+
+        const auto v1 = std::static_pointer_cast<AESEncryptionProvider>(resolve(1).unwrap());
+        for (size_t offset = 0; offset < size; offset += block_size) {
+            secure_bytes plain(std::min(block_size, size - offset));
+            for (size_t i = 0; i < plain.size(); ++i) plain[i] = static_cast<uint8_t>(fileId * 31 + offset / block_size + i);
+
+            BlockInfo block{nextBlock++, offset, {}, {}};
+            block.keyVersion = 1;
+            secure_bytes iv;
+            secure_bytes tag;
+            secure_bytes cipher = generations
+                ? v1->encrypt_with_generation(plain, block.generation, tag).unwrap()
+                : v1->encrypt(plain, iv, tag).unwrap();
+            if (!generations) block.iv.assign(iv.begin(), iv.end());
+            block.tag.assign(tag.begin(), tag.end());
+
+            std::vector<uint8_t> data(cipher.begin(), cipher.end());
+            storage.writeBlock(block.blockId, data).unwrap();
+            meta.blocks.push_back(block);
+        }
+        metadata.upsertMetadata(meta);
+        return fileId;
+    }
+
+    // Reads a file the way the foreground does: metadata and blocks under the shared lock
+    Result<secure_bytes> read_file(const uint64_t fileId) {
+        const auto lock = locks.lock_shared(fileId);
+        const Metadata meta = metadata.getMetadata(fileId);
+        secure_bytes content;
+        for (const BlockInfo& block : meta.blocks) {
+            auto raw = storage.readBlock(block.blockId).unwrap();
+            const secure_bytes cipher(raw.begin(), raw.begin() + static_cast<ptrdiff_t>(std::min<uint64_t>(block_size, meta.size - block.offset)));
+            auto provider = resolve(block.keyVersion).unwrap();
+            secure_bytes tag(block.tag.begin(), block.tag.end());
+            auto plain = block.iv.empty()
+                ? std::static_pointer_cast<AESEncryptionProvider>(provider)->decrypt_with_generation(cipher, block.generation, tag)
+                : provider->decrypt(cipher, secure_bytes(block.iv.begin(), block.iv.end()), tag);
+            if (plain.is_err()) return plain;
+            content.insert(content.end(), plain.unwrap().begin(), plain.unwrap().end());
+        }
+        return Result<secure_bytes>::ok(std::move(content));
+    }
+
+    bool all_blocks_under(const uint32_t version) {
+        for (const uint64_t id : metadata.listMetadataIds()) {
+            for (const BlockInfo& block : metadata.getMetadata(id).blocks) {
+                if (block.keyVersion != version) return false;
+            }
+        }
+        return true;
+    }
+
+    fs::path path;
+    storage::BlockStorage storage;
+    metadata::InMemoryMetadataProvider metadata;
+    FileLockTable locks;
+    std::map<uint32_t, secure_bytes> keys;
+    uint64_t nextBlock = 0;
+
+    std::mutex checkpointMutex;
+    std::optional<ReencryptionCheckpoint> saved;
+};
+
+TEST_F(ReencryptionEngineTest, RotatesEveryBlockAndPreservesContent) {
+    const uint64_t a = write_file("a", 3 * block_size + 100);
+    const uint64_t b = write_file("b", 10, true);
+    metadata.createDirectory("dir", 0, 0755);
+    const secure_bytes before_a = read_file(a).unwrap();
+    const secure_bytes before_b = read_file(b).unwrap();
+
+    ReencryptionEngine engine(metadata, storage, locks, config_for(2));
+    ASSERT_TRUE(engine.run().is_ok());
+
+    const auto progress = engine.progress();
+    EXPECT_TRUE(progress.finished);
+    EXPECT_EQ(progress.blocksReencrypted, 5u);
+    EXPECT_EQ(progress.bytesReencrypted, 3 * block_size + 110);
+    EXPECT_TRUE(all_blocks_under(2));
+    EXPECT_EQ(read_file(a).unwrap(), before_a);
+    EXPECT_EQ(read_file(b).unwrap(), before_b);
+
+    // The old key is no longer needed
+    keys.erase(1);
+    EXPECT_TRUE(read_file(a).is_ok());
+
+    // A second pass finds nothing to do
+    ReencryptionEngine again(metadata, storage, locks, config_for(2));
+    ASSERT_TRUE(again.run().is_ok());
+    EXPECT_EQ(again.progress().blocksReencrypted, 0u);
+    EXPECT_EQ(again.progress().blocksSkipped, 5u);
+}
+
+TEST_F(ReencryptionEngineTest, MissingKeyFailsTheRun) {
+    write_file("a", 100);
+    keys.erase(1);
+    ReencryptionEngine engine(metadata, storage, locks, config_for(2));
+    EXPECT_TRUE(engine.run().is_err());
+    EXPECT_FALSE(engine.progress().finished);
+}
+
+TEST_F(ReencryptionEngineTest, TamperedBlockFailsWithAnAuthenticationError) {
+    const uint64_t file = write_file("a", 100);
+    const uint64_t blockId = metadata.getMetadata(file).blocks[0].blockId;
+    auto raw = storage.readBlock(blockId).unwrap();
+    raw[0] ^= 0x01;
+    storage.writeBlock(blockId, raw).unwrap();
+
+    ReencryptionEngine engine(metadata, storage, locks, config_for(2));
+    const auto result = engine.run();
+    ASSERT_TRUE(result.is_err());
+    EXPECT_EQ(result.unwrap_err().kind(), ErrorKind::Authentication);
+    EXPECT_EQ(metadata.getMetadata(file).blocks[0].keyVersion, 1u);
+}
+
+TEST_F(ReencryptionEngineTest, ResumesFromTheLastCheckpoint) {
+    const uint64_t first = write_file("a", 2 * block_size);
+    const uint64_t second = write_file("b", 2 * block_size);
+
+    auto config = config_for(2);
+    ReencryptionEngine* running = nullptr;
+    const auto persist = config.onCheckpoint;
+    config.onCheckpoint = [&](const ReencryptionCheckpoint& checkpoint) {
+        auto result = persist(checkpoint);
+        if (checkpoint.nextFileId > first) running->stop();
+        return result;
+    };
+    {
+        ReencryptionEngine engine(metadata, storage, locks, config);
+        running = &engine;
+        ASSERT_TRUE(engine.run().is_ok());
+        EXPECT_FALSE(engine.progress().finished);
+    }
+    ASSERT_TRUE(saved.has_value());
+    EXPECT_EQ(saved->nextFileId, first + 1);
+    EXPECT_EQ(metadata.getMetadata(second).blocks[0].keyVersion, 1u);
+
+    auto resume = config_for(2);
+    resume.resumeFrom = saved;
+    ReencryptionEngine engine(metadata, storage, locks, resume);
+    ASSERT_TRUE(engine.run().is_ok());
+    EXPECT_TRUE(engine.progress().finished);
+    // The finished file is not scanned again
+    EXPECT_EQ(engine.progress().blocksReencrypted, 2u);
+    EXPECT_EQ(engine.progress().blocksSkipped, 0u);
+    EXPECT_TRUE(all_blocks_under(2));
+
+    auto mismatched = config_for(3);
+    mismatched.resumeFrom = saved;
+    keys[3] = secure_bytes(32, 0x33);
+    EXPECT_TRUE(ReencryptionEngine(metadata, storage, locks, mismatched).run().is_err());
+}
+
+TEST_F(ReencryptionEngineTest, RecoversFromATornWrite) {
+    const uint64_t file = write_file("a", 2 * block_size);
+    const secure_bytes content = read_file(file).unwrap();
+
+    FaultyStorage faulty(storage);
+    faulty.fault = FaultyStorage::Fault::Torn;
+    {
+        ReencryptionEngine engine(metadata, faulty, locks, config_for(2));
+        ASSERT_TRUE(engine.run().is_err());
+    }
+    ASSERT_TRUE(saved && saved->pending);
+    EXPECT_TRUE(read_file(file).is_err());
+
+    auto resume = config_for(2);
+    resume.resumeFrom = saved;
+    ReencryptionEngine engine(metadata, storage, locks, resume);
+    ASSERT_TRUE(engine.run().is_ok());
+    EXPECT_TRUE(all_blocks_under(2));
+    EXPECT_EQ(read_file(file).unwrap(), content);
+}
+
+TEST_F(ReencryptionEngineTest, CommitsABlockWrittenBeforeACrash) {
+    const uint64_t file = write_file("a", block_size + 1);
+    const secure_bytes content = read_file(file).unwrap();
+
+    FaultyStorage faulty(storage);
+    faulty.fault = FaultyStorage::Fault::LostAcknowledgement;
+    {
+        ReencryptionEngine engine(metadata, faulty, locks, config_for(2));
+        ASSERT_TRUE(engine.run().is_err());
+    }
+    ASSERT_TRUE(saved && saved->pending);
+    // The new ciphertext landed but the metadata still describes the old one
+    EXPECT_TRUE(read_file(file).is_err());
+    const BlockInfo committed = saved->pending->after;
+
+    auto resume = config_for(2);
+    resume.resumeFrom = saved;
+    ReencryptionEngine engine(metadata, storage, locks, resume);
+    ASSERT_TRUE(engine.run().is_ok());
+    EXPECT_EQ(metadata.getMetadata(file).blocks[0].tag, committed.tag);
+    EXPECT_TRUE(all_blocks_under(2));
+    EXPECT_EQ(read_file(file).unwrap(), content);
+}
+
+TEST_F(ReencryptionEngineTest, ForegroundReadersNeverSeeAMismatchedBlock) {
+    std::vector<std::pair<uint64_t, secure_bytes>> files;
+    for (int i = 0; i < 8; ++i) {
+        const uint64_t id = write_file(std::string("f").append(std::to_string(i)), 4 * block_size - 7);
+        files.emplace_back(id, read_file(id).unwrap());
+    }
+
+    auto config = config_for(2);
+    config.blocksPerSecond = 20;
+    ReencryptionEngine engine(metadata, storage, locks, config);
+    engine.start();
+
+    std::atomic<bool> done{false};
+    std::atomic<int> failures{0};
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 3; ++r) {
+        readers.emplace_back([&] {
+            while (!done.load()) {
+                for (const auto& [id, expected] : files) {
+                    auto content = read_file(id);
+                    if (content.is_err() || content.unwrap() != expected) failures.fetch_add(1);
+                }
+            }
+        });
+    }
+
+    ASSERT_TRUE(engine.wait().is_ok());
+    done = true;
+    for (auto& reader : readers) reader.join();
+
+    EXPECT_EQ(failures.load(), 0);
+    EXPECT_TRUE(engine.progress().finished);
+    EXPECT_TRUE(all_blocks_under(2));
+}
+
+TEST_F(ReencryptionEngineTest, ThrottlesToTheBlockRate) {
+    write_file("a", 100 * block_size);
+
+    auto config = config_for(2);
+    config.blocksPerSecond = 50;
+    ReencryptionEngine engine(metadata, storage, locks, config);
+    const auto start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(engine.run().is_ok());
+    const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    // A one-second burst covers the first 50 blocks; the other 50 are paced at 50 per second
+    EXPECT_EQ(engine.progress().blocksReencrypted, 100u);
+    EXPECT_GE(elapsed, 0.8);
+
+}
+
+TEST_F(ReencryptionEngineTest, ThrottlesToTheByteRate) {
+    write_file("a", 10 * block_size);
+
+    // Bytes count read plus write: 10 blocks cost 80 KiB, half of it beyond the 40 KiB burst
+    auto config = config_for(2);
+    config.bytesPerSecond = 40 * 1024;
+    ReencryptionEngine engine(metadata, storage, locks, config);
+    const auto start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(engine.run().is_ok());
+    EXPECT_GE(std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count(), 0.8);
+}
+
+TEST_F(ReencryptionEngineTest, StopsAndResumesInTheBackground) {
+    for (int i = 0; i < 4; ++i) write_file(std::string("f").append(std::to_string(i)), 8 * block_size);
+
+    auto config = config_for(2);
+    config.blocksPerSecond = 20;
+    ReencryptionEngine engine(metadata, storage, locks, config);
+    engine.start();
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    engine.stop();
+    ASSERT_TRUE(engine.wait().is_ok());
+    EXPECT_FALSE(engine.progress().finished);
+    EXPECT_FALSE(all_blocks_under(2));
+
+    auto resume = config_for(2);
+    resume.resumeFrom = saved;
+    ReencryptionEngine resumed(metadata, storage, locks, resume);
+    resumed.start();
+    resumed.set_limits(0, 0);
+    ASSERT_TRUE(resumed.wait().is_ok());
+    EXPECT_TRUE(resumed.progress().finished);
+    EXPECT_TRUE(all_blocks_under(2));
+}
@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+#include <NeonFS/security/stream_aead.h>
+#include <NeonFS/security/aes_encryption_provider.h>
+#include <openssl/rand.h>
+
+using namespace neonfs;
+using namespace neonfs::security;
+
+int main(int argc, char** argv) {
+    initialize_secure_heap(64 * 1024 * 1024);
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+class StreamAEADTest : public ::testing::Test {
+protected:
+    static constexpr size_t kSegmentSize = 1024;
+
+    void SetUp() override {
+        secure_bytes key(32);
+        RAND_bytes(key.data(), key.size());
+        provider = std::make_unique<AESEncryptionProvider>(std::move(key), 4);
+    }
+
+    // Encrypts `data` as a whole stream and returns the concatenated segments
+    secure_bytes encryptStream(const secure_bytes& data, secure_bytes& header) {
+        auto encryptor = StreamEncryptor::create(*provider, kSegmentSize).unwrap_move();
+        header = encryptor.header();
+
+        secure_bytes out;
+        const uint64_t segments = encryptor.layout().segment_count(data.size());
+        for (uint64_t i = 0; i < segments; ++i) {
+            const size_t begin = i * kSegmentSize;
+            const size_t end = std::min(data.size(), begin + kSegmentSize);
+            secure_bytes plain(data.begin() + begin, data.begin() + end);
+            auto segment = encryptor.encrypt_segment(plain, i + 1 == segments).unwrap_move();
+            out.insert(out.end(), segment.begin(), segment.end());
+        }
+        return out;
+    }
+
+    secure_bytes segmentAt(const secure_bytes& stream, const StreamLayout& layout, uint64_t index) {
+        const size_t begin = layout.ciphertext_offset(index);
+        const size_t end = std::min<size_t>(stream.size(), begin + layout.encrypted_segment_size());
+        return secure_bytes(stream.begin() + begin, stream.begin() + end);
+    }
+
+    static secure_bytes patternData(size_t size) {
+        secure_bytes data(size);
+        for (size_t i = 0; i < size; ++i) data[i] = static_cast<uint8_t>(i * 31 + 7);
+        return data;
+    }
+
+    std::unique_ptr<AESEncryptionProvider> provider;
+};
+
+TEST_F(StreamAEADTest, LayoutArithmetic) {
+    const StreamLayout layout(kSegmentSize, 16);
+    EXPECT_EQ(layout.segment_count(0), 1u);
+    EXPECT_EQ(layout.segment_count(kSegmentSize), 1u);
+    EXPECT_EQ(layout.segment_count(kSegmentSize + 1), 2u);
+    EXPECT_EQ(layout.ciphertext_size(kSegmentSize * 3), kSegmentSize * 3 + 3 * 16);
+    EXPECT_EQ(layout.ciphertext_offset(2), 2 * (kSegmentSize + 16));
+}
+
+TEST_F(StreamAEADTest, SequentialRoundtrip) {
+    const secure_bytes data = patternData(kSegmentSize * 5 + 123);
+    secure_bytes header;
+    const secure_bytes stream = encryptStream(data, header);
+
+    auto decryptor = StreamDecryptor::create(*provider, kSegmentSize, header).unwrap_move();
+    const auto& layout = decryptor.layout();
+    ASSERT_EQ(stream.size(), layout.ciphertext_size(data.size()));
+
+    secure_bytes recovered;
+    const uint64_t segments = layout.segment_count(data.size());
+    for (uint64_t i = 0; i < segments; ++i) {
+        auto plain = decryptor.decrypt_segment(i, segmentAt(stream, layout, i), i + 1 == segments);
+        ASSERT_TRUE(plain.is_ok()) << "segment " << i;
+        recovered.insert(recovered.end(), plain.unwrap().begin(), plain.unwrap().end());
+    }
+    EXPECT_EQ(recovered, data);
+}
+
+TEST_F(StreamAEADTest, RandomAccessSegment) {
+    const secure_bytes data = patternData(kSegmentSize * 8);
+    secure_bytes header;
+    const secure_bytes stream = encryptStream(data, header);
+
+    auto decryptor = StreamDecryptor::create(*provider, kSegmentSize, header).unwrap_move();
+    auto plain = decryptor.decrypt_segment(5, segmentAt(stream, decryptor.layout(), 5), false);
+    ASSERT_TRUE(plain.is_ok());
+    EXPECT_TRUE(std::equal(plain.unwrap().begin(), plain.unwrap().end(), data.begin() + 5 * kSegmentSize));
+}
+
+TEST_F(StreamAEADTest, EmptyStreamHasAuthenticatedFinalSegment) {
+    secure_bytes header;
+    const secure_bytes stream = encryptStream({}, header);
+    ASSERT_EQ(stream.size(), provider->tag_size());
+
+    auto decryptor = StreamDecryptor::create(*provider, kSegmentSize, header).unwrap_move();
+    auto plain = decryptor.decrypt_segment(0, stream, true);
+    ASSERT_TRUE(plain.is_ok());
+    EXPECT_TRUE(plain.unwrap().empty());
+}
+
+TEST_F(StreamAEADTest, TruncationIsDetected) {
+    const secure_bytes data = patternData(kSegmentSize * 3);
+    secure_bytes header;
+    const secure_bytes stream = encryptStream(data, header);
+
+    // Presenting a middle segment as the final one must fail
+    auto decryptor = StreamDecryptor::create(*provider, kSegmentSize, header).unwrap_move();
+    EXPECT_TRUE(decryptor.decrypt_segment(1, segmentAt(stream, decryptor.layout(), 1), true).is_err());
+}
+
+TEST_F(StreamAEADTest, ReorderingIsDetected) {
+    const secure_bytes data = patternData(kSegmentSize * 3);
+    secure_bytes header;
+    const secure_bytes stream = encryptStream(data, header);
+
+    auto decryptor = StreamDecryptor::create(*provider, kSegmentSize, header).unwrap_move();
+    EXPECT_TRUE(decryptor.decrypt_segment(0, segmentAt(stream, decryptor.layout(), 1), false).is_err());
+}
+
+TEST_F(StreamAEADTest, EncryptorRejectsMisuse) {
+    auto encryptor = StreamEncryptor::create(*provider, kSegmentSize).unwrap_move();
+
+    // Short non-final segment
+    EXPECT_TRUE(encryptor.encrypt_segment(patternData(10), false).is_err());
+    // Oversized segment
+    EXPECT_TRUE(encryptor.encrypt_segment(patternData(kSegmentSize + 1), true).is_err());
+
+    EXPECT_TRUE(encryptor.encrypt_segment(patternData(10), true).is_ok());
+    EXPECT_TRUE(encryptor.finished());
+    EXPECT_TRUE(encryptor.encrypt_segment(patternData(10), true).is_err());
+}
+
+TEST_F(StreamAEADTest, DistinctStreamsUseDistinctNonces) {
+    auto a = StreamEncryptor::create(*provider, kSegmentSize).unwrap_move();
+    auto b = StreamEncryptor::create(*provider, kSegmentSize).unwrap_move();
+    EXPECT_NE(a.header(), b.header());
+}
+
+TEST_F(StreamAEADTest, DecryptorRejectsBadHeader) {
+    EXPECT_TRUE(StreamDecryptor::create(*provider, kSegmentSize, secure_bytes(3)).is_err());
+}
@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+#include <NeonFS/storage/block_allocator.h>
+#include <set>
+#include <thread>
+
+using namespace neonfs;
+using namespace neonfs::storage;
+
+TEST(BlockAllocatorTest, AllocatesEveryBlockOnceThenRunsOut) {
+    BlockAllocator allocator(8);
+    std::set<uint64_t> seen;
+    for (int i = 0; i < 8; ++i) {
+        auto block = allocator.allocate();
+        ASSERT_TRUE(block.is_ok());
+        EXPECT_TRUE(seen.insert(block.unwrap()).second);
+    }
+    EXPECT_EQ(allocator.free_count(), 0u);
+    EXPECT_EQ(allocator.allocate().unwrap_err().kind(), ErrorKind::ResourceExhausted);
+
+    allocator.release(5);
+    EXPECT_EQ(allocator.allocate().unwrap(), 5u);
+}
+
+TEST(BlockAllocatorTest, MarkUsedRejectsDuplicatesAndOutOfRange) {
+    BlockAllocator allocator(4);
+    EXPECT_TRUE(allocator.mark_used(2));
+    EXPECT_FALSE(allocator.mark_used(2));
+    EXPECT_FALSE(allocator.mark_used(4));
+    EXPECT_TRUE(allocator.is_used(2));
+    EXPECT_EQ(allocator.free_count(), 3u);
+
+    // Allocation skips blocks already in use
+    for (int i = 0; i < 3; ++i) EXPECT_NE(allocator.allocate().unwrap(), 2u);
+
+    allocator.release(2);
+    allocator.release(2);   // Releasing a free block changes nothing
+    EXPECT_EQ(allocator.free_count(), 1u);
+    EXPECT_EQ(allocator.block_count(), 4u);
+}
+
+TEST(BlockAllocatorTest, ConcurrentAllocationsAreDistinct) {
+    BlockAllocator allocator(4000);
+    std::vector<std::vector<uint64_t>> taken(4);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < taken.size(); ++t) {
+        threads.emplace_back([&, t] {
+            for (int i = 0; i < 1000; ++i) taken[t].push_back(allocator.allocate().unwrap());
+        });
+    }
+    for (auto& thread : threads) thread.join();
+
+    std::set<uint64_t> all;
+    for (const auto& blocks : taken) all.insert(blocks.begin(), blocks.end());
+    EXPECT_EQ(all.size(), 4000u);
+    EXPECT_EQ(allocator.free_count(), 0u);
+}
+
+TEST(BlockAllocatorTest, AllocatesContiguousRuns) {
+    BlockAllocator allocator(8);
+    EXPECT_EQ(allocator.allocate(3).unwrap(), 0u);
+    EXPECT_EQ(allocator.allocate(3).unwrap(), 3u);
+    EXPECT_EQ(allocator.allocate(2).unwrap(), 6u);
+
+    // Two free blocks, but not next to each other
+    allocator.release(1);
+    allocator.release(4);
+    EXPECT_EQ(allocator.allocate(2).unwrap_err().kind(), ErrorKind::ResourceExhausted);
+    EXPECT_EQ(allocator.free_count(), 2u);
+
+    allocator.release(5);
+    EXPECT_EQ(allocator.allocate(2).unwrap(), 4u);
+
+    // Runs do not wrap around the end
+    allocator.release(6, 2);
+    allocator.release(0);
+    EXPECT_EQ(allocator.free_count(), 4u);
+    EXPECT_EQ(allocator.allocate(4).unwrap_err().kind(), ErrorKind::ResourceExhausted);
+    EXPECT_EQ(allocator.allocate(0).unwrap_err().kind(), ErrorKind::InvalidArgument);
+}
@@ -67,6 +67,7 @@ TEST_F(BlockStorageTest, ReadWriteOperations) {
 
     // Test read invalid block
     EXPECT_TRUE(storage.readBlock(1000).is_err()); // Beyond block count
+    EXPECT_EQ(storage.readBlock(1000).unwrap_err().kind(), neonfs::ErrorKind::OutOfRange);
 
     // Test write invalid block
     std::vector<uint8_t> data(4096, 0xAA);
@@ -75,7 +76,7 @@ TEST_F(BlockStorageTest, ReadWriteOperations) {
     // Test write with invalid data size
     std::vector<uint8_t> small_data(100, 0xBB);
     auto a = storage.writeBlock(0, small_data);
-    EXPECT_TRUE(a.is_ok()) << a.unwrap_err().message; // Should auto-pad
+    EXPECT_TRUE(a.is_ok()) << a.unwrap_err().message(); // Should auto-pad
     std::vector<uint8_t> large_data(5000, 0xCC);
     EXPECT_TRUE(storage.writeBlock(0, large_data).is_err());
 
@@ -88,15 +89,59 @@ TEST_F(BlockStorageTest, ReadWriteOperations) {
     std::generate(test_data.begin(), test_data.end(), [&](){ return distrib(gen); });
 
     auto b = storage.writeBlock(5, test_data);
-    EXPECT_TRUE(b.is_ok()) << b.unwrap_err().message;
+    EXPECT_TRUE(b.is_ok()) << b.unwrap_err().message();
     auto read_result = storage.readBlock(5);
-    ASSERT_TRUE(read_result.is_ok()) << read_result.unwrap_err().message;
+    ASSERT_TRUE(read_result.is_ok()) << read_result.unwrap_err().message();
     EXPECT_EQ(read_result.unwrap(), test_data);
 
     // Test flush
     EXPECT_TRUE(storage.flush().is_ok());
 }
 
+TEST_F(BlockStorageTest, ReadIntoCallerBuffer) {
+    BlockStorage storage;
+    storage.mount(test_file.string(), config).unwrap();
+
+    std::vector<uint8_t> data(4096, 0x5C);
+    storage.writeBlock(3, data).unwrap();
+
+    // The result borrows the caller's buffer; nothing is allocated for the block
+    std::vector<uint8_t> buffer(8192, 0);
+    auto read = storage.readBlockInto(3, buffer);
+    ASSERT_TRUE(read.is_ok()) << read.unwrap_err().message();
+    EXPECT_EQ(read.unwrap().data(), buffer.data());
+    EXPECT_EQ(read.unwrap().size(), 4096u);
+    EXPECT_TRUE(std::equal(data.begin(), data.end(), buffer.begin()));
+
+    std::vector<uint8_t> small(100);
+    EXPECT_EQ(storage.readBlockInto(3, small).unwrap_err().kind(), neonfs::ErrorKind::InvalidArgument);
+    EXPECT_EQ(storage.readBlockInto(1000, buffer).unwrap_err().kind(), neonfs::ErrorKind::OutOfRange);
+}
+
+TEST_F(BlockStorageTest, RangesLeaveTheRestOfTheBlock) {
+    BlockStorage storage;
+    storage.mount(test_file.string(), config).unwrap();
+
+    std::vector<uint8_t> data(4096, 0x11);
+    storage.writeBlock(5, data).unwrap();
+
+    const std::vector<uint8_t> range(100, 0x22);
+    storage.writeBlockRange(5, 1000, range).unwrap();
+    std::fill(data.begin() + 1000, data.begin() + 1100, uint8_t{0x22});
+    EXPECT_EQ(storage.readBlock(5).unwrap(), data);
+
+    std::vector<uint8_t> out(120);
+    storage.readBlockRange(5, 990, out).unwrap();
+    EXPECT_TRUE(std::equal(out.begin(), out.end(), data.begin() + 990));
+
+    // A range ending exactly at the block end is fine; one past it is not
+    std::vector<uint8_t> tail(96);
+    EXPECT_TRUE(storage.readBlockRange(5, 4000, tail).is_ok());
+    EXPECT_EQ(storage.readBlockRange(5, 4001, tail).unwrap_err().kind(), neonfs::ErrorKind::InvalidArgument);
+    EXPECT_EQ(storage.writeBlockRange(5, 4090, range).unwrap_err().kind(), neonfs::ErrorKind::InvalidArgument);
+    EXPECT_EQ(storage.writeBlockRange(1000, 0, range).unwrap_err().kind(), neonfs::ErrorKind::OutOfRange);
+}
+
 TEST_F(BlockStorageTest, Concurrency) {
     BlockStorage storage;
     storage.mount(test_file.string(), config).unwrap();
@@ -160,7 +205,7 @@ TEST_F(BlockStorageTest, FileValidation) {
         BlockStorage storage;
         auto result = storage.mount("nonexistent.bin", config);
         EXPECT_TRUE(result.is_err());
-        EXPECT_EQ(result.unwrap_err().code, -4);
+        EXPECT_EQ(result.unwrap_err().code(), -4);
     }
 
     // 2. Test corrupted file (wrong size)
@@ -175,7 +220,7 @@ TEST_F(BlockStorageTest, FileValidation) {
         BlockStorage storage;
         auto result = storage.mount(corrupt_file.string(), config);
         EXPECT_TRUE(result.is_err());
-        EXPECT_EQ(result.unwrap_err().code, -5);
+        EXPECT_EQ(result.unwrap_err().code(), -5);
 
         fs::remove(corrupt_file);
     }
@@ -188,7 +233,7 @@ TEST_F(BlockStorageTest, FileValidation) {
         BlockStorage storage;
         auto result = storage.mount(temp_dir.string(), config);
         EXPECT_TRUE(result.is_err());
-        EXPECT_EQ(result.unwrap_err().code, -4);
+        EXPECT_EQ(result.unwrap_err().code(), -4);
 
         fs::remove(temp_dir);
     }
@@ -200,7 +245,7 @@ TEST_F(BlockStorageTest, ConfigValidation) {
         BlockStorage storage;
         auto result = storage.mount(test_file.string(), {0, 4096*100});
         EXPECT_TRUE(result.is_err());
-        EXPECT_EQ(result.unwrap_err().code, -6);
+        EXPECT_EQ(result.unwrap_err().code(), -6);
     }
 }
 
@@ -0,0 +1,69 @@
+#include <gtest/gtest.h>
+#include <NeonFS/storage/tail_packer.h>
+
+using namespace neonfs;
+using namespace neonfs::storage;
+
+TEST(TailPackerTest, PacksExtentsSideBySideAndReusesGaps) {
+    BlockAllocator allocator(4);
+    TailPacker packer(allocator, 512);
+
+    const Extent a = packer.allocate(200).unwrap();
+    const Extent b = packer.allocate(200).unwrap();
+    EXPECT_EQ(a.blockId, b.blockId);
+    EXPECT_EQ(b.offset, 200u);
+    EXPECT_EQ(packer.block_count(), 1u);
+    EXPECT_EQ(allocator.free_count(), 3u);
+
+    // Too large for what is left: a second block
+    const Extent c = packer.allocate(150).unwrap();
+    EXPECT_NE(c.blockId, a.blockId);
+
+    // The gap left by a fits a smaller extent
+    packer.release(a);
+    const Extent d = packer.allocate(100).unwrap();
+    EXPECT_EQ(d.blockId, a.blockId);
+    EXPECT_EQ(d.offset, 0u);
+    EXPECT_EQ(packer.used_bytes(), 450u);
+
+    // A block returns to the allocator with its last extent
+    packer.release(c);
+    EXPECT_EQ(packer.block_count(), 1u);
+    EXPECT_EQ(allocator.free_count(), 3u);
+    packer.release(b);
+    packer.release(d);
+    EXPECT_EQ(allocator.free_count(), 4u);
+    EXPECT_EQ(packer.used_bytes(), 0u);
+
+    EXPECT_EQ(packer.allocate(0).unwrap_err().kind(), ErrorKind::InvalidArgument);
+    EXPECT_EQ(packer.allocate(513).unwrap_err().kind(), ErrorKind::InvalidArgument);
+}
+
+TEST(TailPackerTest, MarkUsedRebuildsPacksAndRejectsConflicts) {
+    BlockAllocator allocator(4);
+    TailPacker packer(allocator, 512);
+
+    EXPECT_TRUE(packer.mark_used({2, 100, 50}));
+    EXPECT_TRUE(packer.mark_used({2, 0, 100}));
+    EXPECT_FALSE(packer.mark_used({2, 120, 10}));      // Overlaps the first
+    EXPECT_FALSE(packer.mark_used({2, 500, 20}));      // Past the end of the block
+    EXPECT_TRUE(allocator.is_used(2));
+    EXPECT_FALSE(allocator.mark_used(2));
+
+    // A block used whole cannot take extents
+    EXPECT_TRUE(allocator.mark_used(3));
+    EXPECT_FALSE(packer.mark_used({3, 0, 10}));
+
+    // New extents fill the rebuilt pack after its last extent
+    const Extent next = packer.allocate(300).unwrap();
+    EXPECT_EQ(next.blockId, 2u);
+    EXPECT_EQ(next.offset, 150u);
+}
+
+TEST(TailPackerTest, RunsOutWithTheAllocator) {
+    BlockAllocator allocator(1);
+    TailPacker packer(allocator, 512);
+    packer.allocate(400).unwrap();
+    EXPECT_EQ(packer.allocate(200).unwrap_err().kind(), ErrorKind::ResourceExhausted);
+    EXPECT_TRUE(packer.allocate(112).is_ok());
+}
@@ -0,0 +1,769 @@
+#include <gtest/gtest.h>
+#include <NeonFS/core/types.h>
+#include <NeonFS/metadata/in_memory_metadata_provider.h>
+#include <NeonFS/security/aes_encryption_provider.h>
+#include <NeonFS/security/reencryption_engine.h>
+#include <NeonFS/storage/block_storage.h>
+#include <NeonFS/volume/volume.h>
+#include <atomic>
+#include <filesystem>
+#include <thread>
+
+namespace fs = std::filesystem;
+using namespace neonfs;
+using namespace neonfs::volume;
+
+int main(int argc, char** argv) {
+    initialize_secure_heap(64 * 1024 * 1024);
+    ::testing::InitGoogleTest(&argc, argv);
+    const int result = RUN_ALL_TESTS();
+    cleanup_secure_heap();
+    return result;
+}
+
+namespace {
+    constexpr size_t block_size = 512;
+    constexpr size_t block_count = 64;
+
+    std::vector<uint8_t> pattern(const size_t size, const uint8_t seed) {
+        std::vector<uint8_t> data(size);
+        for (size_t i = 0; i < size; ++i) data[i] = static_cast<uint8_t>(seed + i * 7);
+        return data;
+    }
+
+    // Passes everything through to a real store and counts the block I/O
+    class CountingStorage final : public IStorageProvider {
+    public:
+        explicit CountingStorage(IStorageProvider& inner) : inner(inner) {}
+
+        Result<std::vector<uint8_t>> readBlock(const uint64_t blockID) override {
+            ++reads;
+            return inner.readBlock(blockID);
+        }
+
+        Result<void> writeBlock(const uint64_t blockID, std::vector<uint8_t>& data) override {
+            ++writes;
+            return inner.writeBlock(blockID, data);
+        }
+
+        Result<void> readBlockRange(const uint64_t blockID, const uint64_t offset, const std::span<uint8_t> buffer) override {
+            ++reads;
+            readBytes += buffer.size();
+            return inner.readBlockRange(blockID, offset, buffer);
+        }
+
+        Result<void> writeBlockRange(const uint64_t blockID, const uint64_t offset, const std::span<const uint8_t> data) override {
+            ++writes;
+            return inner.writeBlockRange(blockID, offset, data);
+        }
+
+        [[nodiscard]] uint64_t getBlockCount() const override { return inner.getBlockCount(); }
+        [[nodiscard]] uint64_t getBlockSize() const override { return inner.getBlockSize(); }
+
+        void reset() { reads = writes = readBytes = 0; }
+
+        size_t reads = 0;
+        size_t writes = 0;
+        size_t readBytes = 0;   // Through range reads
+
+    private:
+        IStorageProvider& inner;
+    };
+
+    // Keeps the interface's read-patch-write range calls, and stalls each block read to widen their window
+    class WholeBlockStorage final : public IStorageProvider {
+    public:
+        explicit WholeBlockStorage(IStorageProvider& inner) : inner(inner) {}
+
+        Result<std::vector<uint8_t>> readBlock(const uint64_t blockID) override {
+            auto block = inner.readBlock(blockID);
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+            return block;
+        }
+
+        Result<void> writeBlock(const uint64_t blockID, std::vector<uint8_t>& data) override {
+            return inner.writeBlock(blockID, data);
+        }
+
+        [[nodiscard]] uint64_t getBlockCount() const override { return inner.getBlockCount(); }
+        [[nodiscard]] uint64_t getBlockSize() const override { return inner.getBlockSize(); }
+
+    private:
+        IStorageProvider& inner;
+    };
+}
+
+class VolumeTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // One file per test, so that ctest can run the tests of this suite in parallel
+        const std::string name = ::testing::UnitTest::GetInstance()->current_test_info()->name();
+        path = fs::temp_directory_path() / ("volume_test_" + name + ".bin");
+        const BlockStorageConfig config{block_size, block_size * block_count};
+        storage::BlockStorage::create(path.string(), config).unwrap();
+        storage.mount(path.string(), config).unwrap();
+        metadata.initialize();
+
+        volume = std::make_unique<Volume>(metadata, storage, locks, config_for(1));
+        volume->mount().unwrap();
+    }
+
+    void TearDown() override {
+        volume.reset();
+        providers.clear();
+        (void)storage.unmount();
+        fs::remove(path);
+    }
+
+    // Providers are kept for the whole test so that a remounted volume continues their IV sequences
+    Result<std::shared_ptr<IEncryptionProvider>> resolve(const uint32_t version) {
+        if (version == 0 || version > 2) return Result<std::shared_ptr<IEncryptionProvider>>::err("Unknown key version");
+        auto& provider = providers[version];
+        if (!provider) {
+            provider = std::make_shared<security::AESEncryptionProvider>(
+                secure_bytes(32, static_cast<uint8_t>(0x10 * version)), 4, security::IVSequence::create(version));
+        }
+        return Result<std::shared_ptr<IEncryptionProvider>>::ok(provider);
+    }
+
+    VolumeConfig config_for(const uint32_t version) {
+        VolumeConfig config;
+        config.resolveKey = [this](const uint32_t keyVersion) { return resolve(keyVersion); };
+        config.keyVersion = version;
+        return config;
+    }
+
+    // Replaces the volume with one that buffers small writes and counts its block I/O
+    void remount_buffered(const size_t bufferBlocks) {
+        volume.reset();
+        VolumeConfig config = config_for(1);
+        config.writeBufferBlocks = bufferBlocks;
+        volume = std::make_unique<Volume>(metadata, counting, locks, std::move(config));
+        volume->mount().unwrap();
+        counting.reset();
+    }
+
+    std::vector<uint8_t> read_all(const uint64_t fileId) {
+        std::vector<uint8_t> content(volume->size(fileId).unwrap());
+        EXPECT_EQ(volume->pread(fileId, content, 0).unwrap(), content.size());
+        return content;
+    }
+
+    fs::path path;
+    storage::BlockStorage storage;
+    metadata::InMemoryMetadataProvider metadata;
+    FileLockTable locks;
+    std::map<uint32_t, std::shared_ptr<IEncryptionProvider>> providers;
+    CountingStorage counting{storage};
+    std::unique_ptr<Volume> volume;
+};
+
+TEST_F(VolumeTest, WritesAndReadsAcrossBlocks) {
+    auto file = volume->create("a.bin", 0, 0644).unwrap();
+    const auto data = pattern(3 * block_size + 100, 1);
+    EXPECT_EQ(file.pwrite(data, 0).unwrap(), data.size());
+    EXPECT_EQ(file.size().unwrap(), data.size());
+    EXPECT_EQ(read_all(file.id()), data);
+
+    // Unaligned range spanning a block boundary
+    std::vector<uint8_t> middle(600);
+    EXPECT_EQ(file.pread(middle, 300).unwrap(), 600u);
+    EXPECT_TRUE(std::equal(middle.begin(), middle.end(), data.begin() + 300));
+
+    // Reads stop at the end of the file
+    std::vector<uint8_t> tail(500);
+    EXPECT_EQ(file.pread(tail, data.size() - 50).unwrap(), 50u);
+    EXPECT_EQ(file.pread(tail, data.size() + 10).unwrap(), 0u);
+
+    // Every block is encrypted on its own under the volume's key version
+    const Metadata meta = metadata.getMetadata(file.id());
+    ASSERT_EQ(meta.blocks.size(), 4u);
+    for (size_t i = 0; i < meta.blocks.size(); ++i) {
+        EXPECT_EQ(meta.blocks[i].offset, i * block_size);
+        EXPECT_EQ(meta.blocks[i].keyVersion, 1u);
+        EXPECT_FALSE(meta.blocks[i].iv.empty());
+        const auto raw = storage.readBlock(meta.blocks[i].blockId).unwrap();
+        EXPECT_FALSE(std::equal(raw.begin(), raw.begin() + 100, data.begin() + static_cast<ptrdiff_t>(i * block_size)));
+    }
+}
+
+TEST_F(VolumeTest, PartialWritesKeepTheRestOfTheBlock) {
+    auto file = volume->create("a.bin", 0, 0644).unwrap();
+    auto expected = pattern(2000, 3);
+    file.pwrite(expected, 0).unwrap();
+
+    const auto patch = pattern(40, 200);
+    file.pwrite(patch, 490).unwrap();   // Straddles the first block boundary
+    std::copy(patch.begin(), patch.end(), expected.begin() + 490);
+    EXPECT_EQ(read_all(file.id()), expected);
+}
+
+TEST_F(VolumeTest, GapsReadAsZerosAndGrowingRewritesThePartialTail) {
+    auto file = volume->create("a.bin", 0, 0644).unwrap();
+    const auto head = pattern(100, 5);
+    file.pwrite(head, 0).unwrap();
+
+    // Grows from a partial block: the old tail block is re-encrypted at its new length
+    const auto more = pattern(100, 9);
+    file.pwrite(more, 100).unwrap();
+
+    const auto far = pattern(10, 11);
+    file.pwrite(far, 1500).unwrap();
+
+    const auto content = read_all(file.id());
+    ASSERT_EQ(content.size(), 1510u);
+    EXPECT_TRUE(std::equal(head.begin(), head.end(), content.begin()));
+    EXPECT_TRUE(std::equal(more.begin(), more.end(), content.begin() + 100));
+    EXPECT_TRUE(std::all_of(content.begin() + 200, content.begin() + 1500, [](const uint8_t b) { return b == 0; }));
+    EXPECT_TRUE(std::equal(far.begin(), far.end(), content.begin() + 1500));
+}
+
+TEST_F(VolumeTest, TruncateShrinksGrowsAndFreesBlocks) {
+    const uint64_t initiallyFree = volume->free_blocks();
+    auto file = volume->create("a.bin", 0, 0644).unwrap();
+    const auto data = pattern(4 * block_size, 13);
+    file.pwrite(data, 0).unwrap();
+    EXPECT_EQ(volume->free_blocks(), initiallyFree - 4);
+
+    file.truncate(700).unwrap();
+    EXPECT_EQ(volume->free_blocks(), initiallyFree - 2);
+    auto content = read_all(file.id());
+    ASSERT_EQ(content.size(), 700u);
+    EXPECT_TRUE(std::equal(content.begin(), content.end(), data.begin()));
+
+    file.truncate(1200).unwrap();
+    content = read_all(file.id());
+    ASSERT_EQ(content.size(), 1200u);
+    EXPECT_TRUE(std::equal(content.begin(), content.begin() + 700, data.begin()));
+    EXPECT_TRUE(std::all_of(content.begin() + 700, content.end(), [](const uint8_t b) { return b == 0; }));
+
+    file.truncate(0).unwrap();
+    EXPECT_EQ(file.size().unwrap(), 0u);
+    EXPECT_EQ(volume->free_blocks(), initiallyFree);
+}
+
+TEST_F(VolumeTest, OverwritesAreCopyOnWrite) {
+    auto file = volume->create("a.bin", 0, 0644).unwrap();
+    file.pwrite(pattern(2 * block_size, 1), 0).unwrap();
+    const uint64_t free = volume->free_blocks();
+    const Metadata before = metadata.getMetadata(file.id());
+
+    file.pwrite(pattern(10, 2), 5).unwrap();
+    const Metadata after = metadata.getMetadata(file.id());
+
+    // Only the touched block moved, and the old one was returned
+    EXPECT_NE(after.blocks[0].blockId, before.blocks[0].blockId);
+    EXPECT_EQ(after.blocks[1].blockId, before.blocks[1].blockId);
+    EXPECT_EQ(volume->free_blocks(), free);
+}
+
+TEST_F(VolumeTest, HandlesReadWriteAndSeekWithACursor) {
+    auto file = volume->create("a.bin", 0, 0644).unwrap();
+    const auto first = pattern(300, 1);
+    const auto second = pattern(400, 2);
+    EXPECT_EQ(file.write(first).unwrap(), 300u);
+    EXPECT_EQ(file.write(second).unwrap(), 400u);
+    EXPECT_EQ(file.tell(), 700u);
+
+    EXPECT_EQ(file.seek(-400, SeekOrigin::End).unwrap(), 300u);
+    std::vector<uint8_t> out(1000);
+    EXPECT_EQ(file.read(out).unwrap(), 400u);
+    EXPECT_TRUE(std::equal(second.begin(), second.end(), out.begin()));
+    EXPECT_EQ(file.tell(), 700u);
+
+    EXPECT_EQ(file.seek(-100, SeekOrigin::Current).unwrap(), 600u);
+    EXPECT_EQ(file.seek(10).unwrap(), 10u);
+    EXPECT_EQ(file.seek(-11, SeekOrigin::Current).unwrap_err().kind(), ErrorKind::InvalidArgument);
+    EXPECT_EQ(file.tell(), 10u);
+
+    auto reopened = volume->open(file.id()).unwrap();
+    EXPECT_EQ(reopened.tell(), 0u);
+    EXPECT_EQ(reopened.read(out).unwrap(), 700u);
+}
+
+TEST_F(VolumeTest, ErrorsCarryTheirKind) {
+    Volume unmounted(metadata, storage, locks, config_for(1));
+    EXPECT_EQ(unmounted.open(0).unwrap_err().kind(), ErrorKind::NotMounted);
+    EXPECT_EQ(volume->mount().unwrap_err().kind(), ErrorKind::InvalidArgument);
+
+    EXPECT_EQ(volume->open(999).unwrap_err().kind(), ErrorKind::NotFound);
+    EXPECT_EQ(volume->open(0).unwrap_err().kind(), ErrorKind::InvalidArgument);   // The root directory
+    EXPECT_EQ(volume->create("x", 999, 0644).unwrap_err().kind(), ErrorKind::InvalidArgument);
+
+    // Running out of space releases what the failed write had allocated
+    auto file = volume->create("big.bin", 0, 0644).unwrap();
+    const uint64_t free = volume->free_blocks();
+    const auto huge = pattern((free + 1) * block_size, 1);
+    EXPECT_EQ(file.pwrite(huge, 0).unwrap_err().kind(), ErrorKind::ResourceExhausted);
+    EXPECT_EQ(volume->free_blocks(), free);
+    EXPECT_EQ(file.size().unwrap(), 0u);
+
+    // Tampered ciphertext fails authentication instead of returning garbage
+    file.pwrite(pattern(100, 1), 0).unwrap();
+    std::vector<uint8_t> garbage(block_size, 0xEE);
+    storage.writeBlock(metadata.getMetadata(file.id()).blocks[0].blockId, garbage).unwrap();
+    std::vector<uint8_t> out(100);
+    EXPECT_EQ(file.pread(out, 0).unwrap_err().kind(), ErrorKind::Authentication);
+
+    // Metadata whose block list disagrees with its size is rejected rather than read past
+    Metadata corrupt = metadata.getMetadata(file.id());
+    corrupt.size += 4 * block_size;
+    metadata.upsertMetadata(corrupt);
+    EXPECT_EQ(file.pread(out, 0).unwrap_err().kind(), ErrorKind::InvalidArgument);
+}
+
+TEST_F(VolumeTest, RemountRebuildsTheAllocationMap) {
+    auto a = volume->create("a.bin", 0, 0644).unwrap();
+    auto b = volume->create("b.bin", 0, 0644).unwrap();
+    const auto dataA = pattern(1500, 1);
+    const auto dataB = pattern(700, 2);
+    a.pwrite(dataA, 0).unwrap();
+    b.pwrite(dataB, 0).unwrap();
+    const uint64_t free = volume->free_blocks();
+
+    volume = std::make_unique<Volume>(metadata, storage, locks, config_for(1));
+    volume->mount().unwrap();
+    EXPECT_EQ(volume->free_blocks(), free);
+    EXPECT_EQ(read_all(a.id()), dataA);
+    EXPECT_EQ(read_all(b.id()), dataB);
+
+    volume->remove(a.id()).unwrap();
+    EXPECT_EQ(volume->free_blocks(), free + 3);
+    EXPECT_EQ(volume->open(a.id()).unwrap_err().kind(), ErrorKind::NotFound);
+}
+
+TEST_F(VolumeTest, ConcurrentWritersAndReadersSeeWholeBlocks) {
+    auto file = volume->create("shared.bin", 0, 0644).unwrap();
+    constexpr size_t blocks = 8;
+    file.pwrite(std::vector<uint8_t>(blocks * block_size, 0), 0).unwrap();
+
+    std::atomic<bool> stop{false};
+    std::atomic<int> torn{0};
+    std::vector<std::thread> threads;
+    for (size_t writer = 0; writer < 4; ++writer) {
+        threads.emplace_back([&, writer] {
+            for (int round = 1; round <= 25; ++round) {
+                // Each writer owns two blocks and fills each with one value
+                const std::vector<uint8_t> fill(block_size, static_cast<uint8_t>(writer * 50 + round));
+                EXPECT_TRUE(file.pwrite(fill, (writer * 2 + round % 2) * block_size).is_ok());
+            }
+        });
+    }
+    for (int reader = 0; reader < 2; ++reader) {
+        threads.emplace_back([&] {
+            std::vector<uint8_t> out(blocks * block_size);
+            while (!stop.load()) {
+                if (file.pread(out, 0).unwrap() != out.size()) ++torn;
+                for (size_t b = 0; b < blocks; ++b) {
+                    const auto begin = out.begin() + static_cast<ptrdiff_t>(b * block_size);
+                    if (!std::all_of(begin, begin + block_size, [&](const uint8_t v) { return v == *begin; })) ++torn;
+                }
+            }
+        });
+    }
+    for (size_t i = 0; i < 4; ++i) threads[i].join();
+    stop = true;
+    for (size_t i = 4; i < threads.size(); ++i) threads[i].join();
+
+    EXPECT_EQ(torn.load(), 0);
+    const auto content = read_all(file.id());
+    for (size_t writer = 0; writer < 4; ++writer) {
+        EXPECT_EQ(content[(writer * 2 + 1) * block_size], static_cast<uint8_t>(writer * 50 + 25));
+        EXPECT_EQ(content[writer * 2 * block_size], static_cast<uint8_t>(writer * 50 + 24));
+    }
+}
+
+TEST_F(VolumeTest, ReadsFollowEachBlocksKeyVersionDuringRotation) {
+    auto file = volume->create("a.bin", 0, 0644).unwrap();
+    auto expected = pattern(3 * block_size, 7);
+    file.pwrite(expected, 0).unwrap();
+
+    // Foreground writes switch to the new key as the rotation starts
+    volume->set_key_version(2);
+    EXPECT_EQ(volume->key_version(), 2u);
+    const auto patch = pattern(20, 99);
+    file.pwrite(patch, block_size + 5).unwrap();
+    std::copy(patch.begin(), patch.end(), expected.begin() + block_size + 5);
+
+    Metadata meta = metadata.getMetadata(file.id());
+    EXPECT_EQ(meta.blocks[0].keyVersion, 1u);
+    EXPECT_EQ(meta.blocks[1].keyVersion, 2u);
+    EXPECT_EQ(read_all(file.id()), expected);
+
+    security::ReencryptionConfig rotation;
+    rotation.targetVersion = 2;
+    rotation.resolveKey = [this](const uint32_t version) { return resolve(version); };
+    security::ReencryptionEngine engine(metadata, storage, locks, std::move(rotation));
+    engine.run().unwrap();
+    EXPECT_EQ(engine.progress().blocksReencrypted, 2u);
+    EXPECT_EQ(engine.progress().blocksSkipped, 1u);
+
+    meta = metadata.getMetadata(file.id());
+    for (const auto& block : meta.blocks) EXPECT_EQ(block.keyVersion, 2u);
+    EXPECT_EQ(read_all(file.id()), expected);
+}
+
+TEST_F(VolumeTest, SmallWritesToABlockCoalesceIntoOneWriteAtFlush) {
+    auto file = volume->create("a.bin", 0, 0644).unwrap();
+    auto expected = pattern(2 * block_size, 1);
+    file.pwrite(expected, 0).unwrap();
+    remount_buffered(8);
+    file = volume->open(file.id()).unwrap();
+
+    // Overlapping writes into the first block stay in memory, and reads see them
+    for (size_t i = 0; i < 16; ++i) {
+        const auto patch = pattern(40, static_cast<uint8_t>(100 + i));
+        file.pwrite(patch, 10 + i * 25).unwrap();
+        std::copy(patch.begin(), patch.end(), expected.begin() + static_cast<ptrdiff_t>(10 + i * 25));
+    }
+    EXPECT_EQ(counting.writes, 0u);
+    EXPECT_EQ(counting.reads, 0u);
+    EXPECT_EQ(volume->buffered_blocks(), 1u);
+    EXPECT_EQ(read_all(file.id()), expected);
+
+    // One read-modify-write cycle for all of them
+    counting.reset();
+    volume->flush().unwrap();
+    EXPECT_EQ(counting.writes, 1u);
+    EXPECT_EQ(counting.reads, 1u);
+    EXPECT_EQ(volume->buffered_blocks(), 0u);
+
+    // Small writes that cover the second block between them need no read at all
+    for (size_t i = 0; i < 4; ++i) {
+        const auto patch = pattern(block_size / 4, static_cast<uint8_t>(200 + i));
+        file.pwrite(patch, block_size + i * block_size / 4).unwrap();
+        std::copy(patch.begin(), patch.end(), expected.begin() + static_cast<ptrdiff_t>(block_size + i * block_size / 4));
+    }
+    counting.reset();
+    file.flush().unwrap();
+    EXPECT_EQ(counting.writes, 1u);
+    EXPECT_EQ(counting.reads, 0u);
+
+    volume.reset();
+    volume = std::make_unique<Volume>(metadata, storage, locks, config_for(1));
+    volume->mount().unwrap();
+    EXPECT_EQ(read_all(file.id()), expected);
+}
+
+TEST_F(VolumeTest, BufferedWritesGrowTruncateAndRemove) {
+    remount_buffered(8);
+    const uint64_t initiallyFree = volume->free_blocks();
+    auto file = volume->create("a.bin", 0, 0644).unwrap();
+
+    // Buffered writes past the end grow the file, with a zero-filled gap
+    const auto head = pattern(100, 1);
+    const auto far = pattern(50, 2);
+    file.pwrite(head, 0).unwrap();
+    file.pwrite(far, 3 * block_size + 20).unwrap();
+    EXPECT_EQ(counting.writes, 0u);
+    EXPECT_EQ(file.size().unwrap(), 3 * block_size + 70);
+
+    std::vector<uint8_t> expected(3 * block_size + 70, 0);
+    std::copy(head.begin(), head.end(), expected.begin());
+    std::copy(far.begin(), far.end(), expected.begin() + 3 * block_size + 20);
+    EXPECT_EQ(read_all(file.id()), expected);
+
+    // Truncating applies the buffered writes it keeps and drops the rest
+    file.truncate(block_size + 10).unwrap();
+    EXPECT_EQ(volume->buffered_blocks(), 0u);
+    expected.resize(block_size + 10);
+    EXPECT_EQ(read_all(file.id()), expected);
+    EXPECT_EQ(volume->free_blocks(), initiallyFree - 2);
+
+    file.pwrite(pattern(10, 3), 5).unwrap();
+    EXPECT_EQ(volume->buffered_blocks(), 1u);
+    volume->remove(file.id()).unwrap();
+    EXPECT_EQ(volume->buffered_blocks(), 0u);
+    EXPECT_EQ(volume->free_blocks(), initiallyFree);
+    volume->flush().unwrap();
+}
+
+TEST_F(VolumeTest, WritesThroughMergeTheBuffer) {
+    auto file = volume->create("a.bin", 0, 0644).unwrap();
+    auto expected = pattern(4 * block_size, 1);
+    file.pwrite(expected, 0).unwrap();
+    remount_buffered(2);
+    file = volume->open(file.id()).unwrap();
+
+    const auto apply = [&](const std::vector<uint8_t>& data, const size_t offset) {
+        file.pwrite(data, offset).unwrap();
+        std::copy(data.begin(), data.end(), expected.begin() + static_cast<ptrdiff_t>(offset));
+    };
+    apply(pattern(30, 10), 5);
+    apply(pattern(30, 11), 3 * block_size + 5);
+    EXPECT_EQ(volume->buffered_blocks(), 2u);
+    EXPECT_EQ(counting.writes, 0u);
+
+    // The buffer is full, so this write goes through and takes the buffered ones along
+    apply(pattern(30, 12), block_size + 5);
+    EXPECT_EQ(volume->buffered_blocks(), 0u);
+    EXPECT_EQ(counting.writes, 3u);
+    EXPECT_EQ(read_all(file.id()), expected);
+
+    // A write covering a whole block always goes through, over the buffered bytes it overlaps
+    apply(pattern(30, 13), block_size + 100);
+    apply(pattern(2 * block_size, 14), block_size - 50);
+    EXPECT_EQ(volume->buffered_blocks(), 0u);
+    EXPECT_EQ(read_all(file.id()), expected);
+
+    volume.reset();
+    volume = std::make_unique<Volume>(metadata, storage, locks, config_for(1));
+    volume->mount().unwrap();
+    EXPECT_EQ(read_all(file.id()), expected);
+}
+
+TEST_F(VolumeTest, DestroyingTheVolumeFlushesIt) {
+    remount_buffered(8);
+    auto file = volume->create("a.bin", 0, 0644).unwrap();
+    const auto data = pattern(200, 4);
+    file.pwrite(data, 0).unwrap();
+    EXPECT_EQ(counting.writes, 0u);
+
+    volume.reset();
+    volume = std::make_unique<Volume>(metadata, storage, locks, config_for(1));
+    volume->mount().unwrap();
+    EXPECT_EQ(read_all(file.id()), data);
+}
+
+TEST_F(VolumeTest, LargeChunksSpanContiguousStorageBlocks) {
+    const uint64_t initiallyFree = volume->free_blocks();
+    constexpr size_t chunk = 4 * block_size;
+    auto file = volume->create("media.bin", 0, 0644, 4).unwrap();
+    auto expected = pattern(2 * chunk + 904, 1);
+    file.pwrite(expected, 0).unwrap();
+
+    // Two full chunks and a tail of two storage blocks, each with one IV and tag
+    Metadata meta = metadata.getMetadata(file.id());
+    EXPECT_EQ(meta.chunkBlocks, 4u);
+    ASSERT_EQ(meta.blocks.size(), 3u);
+    EXPECT_EQ(meta.blocks[0].blockCount, 4u);
+    EXPECT_EQ(meta.blocks[1].offset, chunk);
+    EXPECT_EQ(meta.blocks[2].blockCount, 2u);
+    EXPECT_EQ(volume->free_blocks(), initiallyFree - 10);
+    EXPECT_EQ(read_all(file.id()), expected);
+
+    // A write inside a chunk rewrites only that chunk, across a storage block boundary
+    const auto patch = pattern(30, 77);
+    file.pwrite(patch, chunk + block_size - 10).unwrap();
+    std::copy(patch.begin(), patch.end(), expected.begin() + static_cast<ptrdiff_t>(chunk + block_size - 10));
+    const Metadata after = metadata.getMetadata(file.id());
+    EXPECT_EQ(after.blocks[0].blockId, meta.blocks[0].blockId);
+    EXPECT_NE(after.blocks[1].blockId, meta.blocks[1].blockId);
+    EXPECT_EQ(volume->free_blocks(), initiallyFree - 10);
+
+    std::vector<uint8_t> middle(chunk);
+    EXPECT_EQ(file.pread(middle, chunk / 2).unwrap(), chunk);
+    EXPECT_TRUE(std::equal(middle.begin(), middle.end(), expected.begin() + chunk / 2));
+
+    // Shrinking to a partial chunk re-encrypts it into fewer storage blocks
+    file.truncate(chunk + 52).unwrap();
+    expected.resize(chunk + 52);
+    meta = metadata.getMetadata(file.id());
+    ASSERT_EQ(meta.blocks.size(), 2u);
+    EXPECT_EQ(meta.blocks[1].blockCount, 1u);
+    EXPECT_EQ(volume->free_blocks(), initiallyFree - 5);
+
+    // Mount marks every storage block of every chunk, and rotation rewrites whole chunks
+    volume.reset();
+    volume = std::make_unique<Volume>(metadata, storage, locks, config_for(1));
+    volume->mount().unwrap();
+    EXPECT_EQ(volume->free_blocks(), initiallyFree - 5);
+
+    security::ReencryptionConfig rotation;
+    rotation.targetVersion = 2;
+    rotation.resolveKey = [this](const uint32_t version) { return resolve(version); };
+    security::ReencryptionEngine engine(metadata, storage, locks, std::move(rotation));
+    engine.run().unwrap();
+    EXPECT_EQ(engine.progress().blocksReencrypted, 2u);
+    EXPECT_EQ(read_all(file.id()), expected);
+}
+
+TEST_F(VolumeTest, ChunkSizeDefaultsToTheVolumeAndIsBounded) {
+    volume.reset();
+    VolumeConfig config = config_for(1);
+    config.chunkBlocks = 2;
+    config.writeBufferBlocks = 8;
+    volume = std::make_unique<Volume>(metadata, storage, locks, std::move(config));
+    volume->mount().unwrap();
+
+    auto file = volume->create("a.bin", 0, 0644).unwrap();
+    EXPECT_EQ(metadata.getMetadata(file.id()).chunkBlocks, 2u);
+    auto small = volume->create("b.bin", 0, 0644, 1).unwrap();
+    EXPECT_EQ(metadata.getMetadata(small.id()).chunkBlocks, 1u);
+
+    // The buffer counts storage blocks, so a buffered chunk costs all of its blocks
+    file.pwrite(pattern(10, 1), 0).unwrap();
+    EXPECT_EQ(volume->buffered_blocks(), 2u);
+    volume->flush().unwrap();
+
+    const auto tooLarge = static_cast<uint32_t>(Volume::max_chunk_size / block_size + 1);
+    EXPECT_EQ(volume->create("c.bin", 0, 0644, tooLarge).unwrap_err().kind(), ErrorKind::InvalidArgument);
+
+    VolumeConfig invalid = config_for(1);
+    invalid.chunkBlocks = 0;
+    EXPECT_THROW(Volume(metadata, storage, locks, std::move(invalid)), std::invalid_argument);
+}
+
+TEST_F(VolumeTest, SmallFilesLiveInlineInTheirMetadata) {
+    volume.reset();
+    VolumeConfig config = config_for(1);
+    config.inlineThreshold = 300;
+    volume = std::make_unique<Volume>(metadata, counting, locks, std::move(config));
+    volume->mount().unwrap();
+    const uint64_t initiallyFree = volume->free_blocks();
+    counting.reset();
+
+    auto file = volume->create("config.json", 0, 0644).unwrap();
+    auto expected = pattern(200, 1);
+    file.pwrite(expected, 0).unwrap();
+    Metadata meta = metadata.getMetadata(file.id());
+    ASSERT_EQ(meta.blocks.size(), 1u);
+    EXPECT_EQ(meta.blocks[0].blockCount, 0u);
+    ASSERT_EQ(meta.blocks[0].inlineData.size(), expected.size());
+    EXPECT_NE(meta.blocks[0].inlineData, expected);
+    EXPECT_EQ(read_all(file.id()), expected);
+    EXPECT_EQ(counting.reads + counting.writes, 0u);
+    EXPECT_EQ(volume->free_blocks(), initiallyFree);
+
+    // Outgrowing the threshold moves the file to storage blocks
+    const auto more = pattern(500, 2);
+    file.pwrite(more, expected.size()).unwrap();
+    expected.insert(expected.end(), more.begin(), more.end());
+    meta = metadata.getMetadata(file.id());
+    ASSERT_EQ(meta.blocks.size(), 2u);
+    EXPECT_NE(meta.blocks[0].blockCount, 0u);
+    EXPECT_TRUE(meta.blocks[0].inlineData.empty());
+    EXPECT_EQ(volume->free_blocks(), initiallyFree - 2);
+    EXPECT_EQ(read_all(file.id()), expected);
+
+    // Shrinking below it brings the file back and frees its blocks
+    file.truncate(400).unwrap();
+    expected.resize(400);
+    EXPECT_EQ(metadata.getMetadata(file.id()).blocks[0].blockCount, 1u);
+    EXPECT_EQ(volume->free_blocks(), initiallyFree - 1);
+    file.truncate(100).unwrap();
+    expected.resize(100);
+    EXPECT_EQ(metadata.getMetadata(file.id()).blocks[0].blockCount, 0u);
+    EXPECT_EQ(volume->free_blocks(), initiallyFree);
+    EXPECT_EQ(read_all(file.id()), expected);
+
+    // Rotation re-encrypts inline data through the metadata alone
+    counting.reset();
+    security::ReencryptionConfig rotation;
+    rotation.targetVersion = 2;
+    rotation.resolveKey = [this](const uint32_t version) { return resolve(version); };
+    security::ReencryptionEngine engine(metadata, counting, locks, std::move(rotation));
+    engine.run().unwrap();
+    EXPECT_EQ(engine.progress().blocksReencrypted, 1u);
+    EXPECT_EQ(counting.reads + counting.writes, 0u);
+    EXPECT_EQ(metadata.getMetadata(file.id()).blocks[0].keyVersion, 2u);
+
+    // A volume without inlining still reads the file, and moves it out on the next write
+    volume.reset();
+    volume = std::make_unique<Volume>(metadata, storage, locks, config_for(2));
+    volume->mount().unwrap();
+    EXPECT_EQ(read_all(file.id()), expected);
+    volume->pwrite(file.id(), pattern(1, 3), 0).unwrap();
+    expected[0] = pattern(1, 3)[0];
+    EXPECT_EQ(metadata.getMetadata(file.id()).blocks[0].blockCount, 1u);
+    EXPECT_EQ(read_all(file.id()), expected);
+}
+
+TEST_F(VolumeTest, TailsOfSmallFilesShareBlocks) {
+    volume.reset();
+    VolumeConfig config = config_for(1);
+    config.packThreshold = 200;
+    volume = std::make_unique<Volume>(metadata, counting, locks, std::move(config));
+    volume->mount().unwrap();
+    const uint64_t initiallyFree = volume->free_blocks();
+
+    // Five 90-byte files fit one block, each its own extent with its own IV and tag
+    std::vector<uint64_t> files;
+    std::map<uint64_t, std::vector<uint8_t>> expected;
+    for (uint8_t i = 0; i < 5; ++i) {
+        auto file = volume->create("small" + std::to_string(i), 0, 0644).unwrap();
+        expected[file.id()] = pattern(90, static_cast<uint8_t>(10 * i));
+        file.pwrite(expected[file.id()], 0).unwrap();
+        files.push_back(file.id());
+    }
+    EXPECT_EQ(volume->free_blocks(), initiallyFree - 1);
+    EXPECT_EQ(volume->packed_blocks(), 1u);
+    const Metadata first = metadata.getMetadata(files[0]);
+    const Metadata second = metadata.getMetadata(files[1]);
+    EXPECT_TRUE(first.blocks[0].packed);
+    EXPECT_EQ(first.blocks[0].blockId, second.blocks[0].blockId);
+    EXPECT_NE(first.blocks[0].packedOffset, second.blocks[0].packedOffset);
+    EXPECT_NE(first.blocks[0].iv, second.blocks[0].iv);
+
+    // A read fetches only the file's own extent
+    counting.reset();
+    EXPECT_EQ(read_all(files[2]), expected[files[2]]);
+    EXPECT_EQ(counting.reads, 1u);
+    EXPECT_EQ(counting.readBytes, 90u);
+
+    // Rewriting a tail moves it to a free extent without touching its neighbours
+    auto rewritten = pattern(120, 200);
+    volume->pwrite(files[2], rewritten, 0).unwrap();
+    expected[files[2]] = rewritten;
+    for (const uint64_t id : files) EXPECT_EQ(read_all(id), expected[id]);
+
+    // Growing past the threshold takes the tail out of the pack; a new short tail is packed again
+    auto large = pattern(block_size + 50, 7);
+    volume->pwrite(files[0], large, 0).unwrap();
+    expected[files[0]] = large;
+    const Metadata grown = metadata.getMetadata(files[0]);
+    EXPECT_FALSE(grown.blocks[0].packed);
+    EXPECT_TRUE(grown.blocks[1].packed);
+    EXPECT_EQ(read_all(files[0]), expected[files[0]]);
+
+    // Remount rebuilds the packs, and rotation rewrites extents in place
+    const uint64_t free = volume->free_blocks();
+    volume.reset();
+    volume = std::make_unique<Volume>(metadata, storage, locks, config_for(1));
+    volume->mount().unwrap();
+    EXPECT_EQ(volume->free_blocks(), free);
+
+    security::ReencryptionConfig rotation;
+    rotation.targetVersion = 2;
+    rotation.resolveKey = [this](const uint32_t version) { return resolve(version); };
+    security::ReencryptionEngine engine(metadata, storage, locks, std::move(rotation));
+    engine.run().unwrap();
+    for (const uint64_t id : files) EXPECT_EQ(read_all(id), expected[id]);
+
+    for (const uint64_t id : files) volume->remove(id).unwrap();
+    EXPECT_EQ(volume->free_blocks(), initiallyFree);
+    EXPECT_EQ(volume->packed_blocks(), 0u);
+}
+
+TEST_F(VolumeTest, ConcurrentTailWritesToOnePackBlockKeepEachOther) {
+    WholeBlockStorage wholeBlocks(storage);
+    volume.reset();
+    VolumeConfig config = config_for(1);
+    config.packThreshold = 200;
+    volume = std::make_unique<Volume>(metadata, wholeBlocks, locks, std::move(config));
+    volume->mount().unwrap();
+
+    // Five 90-byte tails share one pack block; each writer keeps rewriting its own
+    constexpr size_t writers = 5;
+    constexpr int rounds = 20;
+    std::vector<uint64_t> files;
+    for (size_t i = 0; i < writers; ++i) {
+        auto file = volume->create("tail" + std::to_string(i), 0, 0644).unwrap();
+        file.pwrite(pattern(90, static_cast<uint8_t>(i)), 0).unwrap();
+        files.push_back(file.id());
+    }
+
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < writers; ++i) {
+        threads.emplace_back([&, i] {
+            for (int round = 0; round < rounds; ++round) {
+                volume->pwrite(files[i], pattern(90, static_cast<uint8_t>(round * writers + i)), 0).unwrap();
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+
+    for (size_t i = 0; i < writers; ++i) {
+        EXPECT_EQ(read_all(files[i]), pattern(90, static_cast<uint8_t>((rounds - 1) * writers + i)));
+    }
+}